@@ -0,0 +1,197 @@
+// HUD frame benchmark: a title and ROWS telemetry rows (name, value, bar)
+// built as a dynamic Widget/StackLayout tree vs. a static_tree inside one
+// StaticWidget. Every frame rewrites all values, then lays out and draws.
+// Both trees are rendered once with SoftwareRenderer and must give the same
+// pixels. Results go to stdout (or --out FILE) as JSON.
+//
+//   hud_bench [--quick] [--frames N] [--out FILE]
+#include "../widget.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+namespace st = static_tree;
+
+constexpr size_t ROWS = 24;
+constexpr int BAR_W = 100, BAR_H = 10;
+
+static double usSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+// draws nothing: isolates the cost of walking the tree
+class NullRenderer : public Renderer {
+public:
+    size_t calls = 0;
+    void fillRect(const Rect&, Color) override { ++calls; }
+    void drawLine(double, double, double, double, Color) override { ++calls; }
+    void pushClip(const Rect&) override {}
+    void popClip() override {}
+    void drawText(const Rect&, std::wstring_view, const FontDesc&, Color, const TextFormat&, const TextLayout*) override { ++calls; }
+    TextMeasurer& measurer() override { return glyphTextMeasurer(); }
+};
+
+static std::vector<std::wstring> valueTexts() {
+    std::vector<std::wstring> v;
+    for (int i = 0; i < 64; ++i) v.push_back(std::to_wstring(i * 37 % 1000) + L"." + std::to_wstring(i % 10) + L" kPa");
+    return v;
+}
+
+static TextStyle titleStyle() {
+    TextStyle s(L"Segoe UI", 12);
+    s.setBold(true);
+    return s;
+}
+
+static Color barColor(size_t row) { return Color::rgb(40, (uint8_t)(80 + row * 7), 160); }
+
+// ---- dynamic tree ----
+struct DynamicHud {
+    std::unique_ptr<Widget> root;
+    std::vector<Label*> values;
+};
+
+static DynamicHud buildDynamic() {
+    DynamicHud h;
+    auto panel = std::make_unique<Panel>();
+    auto col = std::make_unique<StackLayout>();
+    col->spacing = 2;
+    col->padding = 6;
+    panel->layout = std::move(col);
+    panel->addChild(std::make_unique<Label>(L"Telemetry", titleStyle()));
+    for (size_t r = 0; r < ROWS; ++r) {
+        auto row = std::make_unique<Widget>();
+        auto stack = std::make_unique<StackLayout>(Orientation::Horizontal);
+        stack->spacing = 8;
+        row->layout = std::move(stack);
+        row->addChild(std::make_unique<Label>(L"channel " + std::to_wstring(r)));
+        auto value = std::make_unique<Label>();
+        h.values.push_back(value.get());
+        row->addChild(std::move(value));
+        auto bar = std::make_unique<Panel>();
+        bar->setFixedSize(BAR_W, BAR_H);
+        bar->setBackground(barColor(r));
+        row->addChild(std::move(bar));
+        panel->addChild(std::move(row));
+    }
+    h.root = std::move(panel);
+    return h;
+}
+
+// ---- static tree ----
+using HudRow = st::Row<8, 0, st::Text, st::Text, st::Sized<BAR_W, BAR_H, st::Fill>>;
+
+template <class Seq> struct HudOf;
+template <size_t... I> struct HudOf<std::index_sequence<I...>> {
+    using type = st::Column<2, 6, st::Text, std::conditional_t<(I >= 0), HudRow, void>...>;
+};
+using Hud = HudOf<std::make_index_sequence<ROWS>>::type;
+
+static std::unique_ptr<StaticWidget<Hud>> buildStatic() {
+    auto w = std::make_unique<StaticWidget<Hud>>();
+    Hud& hud = w->edit();
+    hud.setBackground(Color::rgb(240, 240, 240));
+    st::at<0>(hud) = st::Text(L"Telemetry", titleStyle());
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((st::at<I + 1, 0>(hud).setText(L"channel " + std::to_wstring(I)),
+          st::at<I + 1, 2, 0>(hud).color = barColor(I)), ...);
+    }(std::make_index_sequence<ROWS>());
+    return w;
+}
+
+template <size_t... I>
+static void setStaticValues(Hud& hud, const std::vector<std::wstring>& texts, size_t frame, std::index_sequence<I...>) {
+    (st::at<I + 1, 1>(hud).setText(texts[(frame + I) % texts.size()]), ...);
+}
+
+// both trees were measured with the glyph measurer SoftwareRenderer draws with
+static bool samePixels(Widget* a, Widget* b, int w, int h) {
+    Framebuffer fa(w, h), fb(w, h);
+    SoftwareRenderer ra(fa), rb(fb);
+    a->draw(ra);
+    b->draw(rb);
+    return fa.pixels == fb.pixels;
+}
+
+int main(int argc, char** argv) {
+    int frames = 20000;
+    std::string outPath;
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : "0"; };
+        if (!std::strcmp(argv[i], "--quick")) frames = 200;
+        else if (!std::strcmp(argv[i], "--frames")) frames = std::atoi(next());
+        else if (!std::strcmp(argv[i], "--out")) outPath = next();
+        else {
+            std::fprintf(stderr, "usage: %s [--quick] [--frames N] [--out FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    NullRenderer null;
+    std::vector<std::wstring> texts = valueTexts();
+    LayoutConstraints screen{ 0, 0, 480, 800 };
+
+    DynamicHud dyn = buildDynamic();
+    WidgetManager dm(std::move(dyn.root), &null);
+    auto staticHud = buildStatic();
+    StaticWidget<Hud>* sw = staticHud.get();
+    WidgetManager sm(std::move(staticHud), &null);
+
+    // warm-up: text layouts cached, first full layout done
+    for (size_t f = 0; f < texts.size(); ++f) {
+        for (size_t r = 0; r < ROWS; ++r) dyn.values[r]->setText(texts[(f + r) % texts.size()]);
+        dm.performLayout(screen);
+        setStaticValues(sw->edit(), texts, f, std::make_index_sequence<ROWS>());
+        sm.performLayout(screen);
+    }
+
+    size_t drawCalls[2] = { 0, 0 };
+    auto run = [&](bool isStatic, double& layoutUs, double& drawUs) {
+        WidgetManager& m = isStatic ? sm : dm;
+        layoutUs = drawUs = 0;
+        null.calls = 0;
+        for (int f = 0; f < frames; ++f) {
+            auto t0 = Clock::now();
+            if (isStatic) {
+                setStaticValues(sw->edit(), texts, (size_t)f, std::make_index_sequence<ROWS>());
+            } else {
+                for (size_t r = 0; r < ROWS; ++r) dyn.values[r]->setText(texts[(f + r) % texts.size()]);
+            }
+            m.performLayout(screen);
+            auto t1 = Clock::now();
+            m.root->draw(null);
+            drawUs += usSince(t1);
+            layoutUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+            m.root->takeDamage();
+        }
+        drawCalls[isStatic] = null.calls / std::max(1, frames);
+        layoutUs /= std::max(1, frames);
+        drawUs /= std::max(1, frames);
+    };
+    double dynLayout, dynDraw, stLayout, stDraw;
+    run(false, dynLayout, dynDraw);
+    run(true, stLayout, stDraw);
+
+    dm.performLayout(screen);
+    sm.performLayout(screen);
+    bool same = drawCalls[0] == drawCalls[1] && samePixels(dm.root.get(), sm.root.get(), 480, 800);
+
+    FILE* out = outPath.empty() ? stdout : std::fopen(outPath.c_str(), "w");
+    if (!out) {
+        std::perror(outPath.c_str());
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"benchmark\": \"hud_frame\",\n  \"unit\": {\"time\": \"us/frame\"},\n  \"rows\": %zu,\n  \"frames\": %d,\n"
+                      "  \"results\": [\n"
+                      "    {\"tree\": \"dynamic\", \"update_layout\": %.3f, \"draw\": %.3f, \"draw_calls\": %zu},\n"
+                      "    {\"tree\": \"static\", \"update_layout\": %.3f, \"draw\": %.3f, \"draw_calls\": %zu}\n"
+                      "  ],\n  \"same_pixels\": %s\n}\n",
+                 ROWS, frames, dynLayout, dynDraw, drawCalls[0], stLayout, stDraw, drawCalls[1], same ? "true" : "false");
+    if (out != stdout) std::fclose(out);
+    if (!same) std::fprintf(stderr, "hud_bench: static tree draws differently from the dynamic tree\n");
+    return same ? 0 : 1;
+}
@@ -0,0 +1,427 @@
+// Headless layout benchmark: synthetic trees (deep / wide / mixed / cards) for
+// every built-in layout, timing performLayout, hitTest and collectFocusable.
+// Each tree is built twice: Panels with layouts in Widget::layout (virtual
+// calls) and LayoutPanels holding them inline (std::visit dispatch). A tree
+// with fixed-size cards is also edited frame by frame, and its incremental
+// layout must match a full one; a mismatch fails the run.
+// Results go to stdout (or --out FILE) as JSON.
+//
+//   layout_bench [--quick] [--max-nodes N] [--min-nodes N] [--layout NAME] [--shape NAME] [--slot NAME] [--out FILE]
+#include "../widget.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <random>
+#include <functional>
+
+// fixed extents, no wrapping work: keeps text cost out of the layout numbers
+class StubTextMeasurer : public TextMeasurer {
+public:
+    TextLayout layoutText(const FontDesc&, std::wstring_view text, double, bool) override {
+        TextLayout out;
+        out.lineHeight = 15;
+        out.lines.push_back({0, text.size(), 7.0 * text.size()});
+        out.extent = {7.0 * text.size(), 15};
+        return out;
+    }
+    double charAdvance(const FontDesc&, wchar_t) override { return 7.0; }
+    bool threadSafe() const override { return true; }
+};
+
+using Clock = std::chrono::steady_clock;
+
+static double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+enum class LayoutKind { Stack, Grid, Flow, Dock, Absolute };
+enum class Shape { Deep, Wide, Mixed, Cards };
+enum class Slot { Virtual, Inline };
+
+static const char* layoutName(LayoutKind k) {
+    switch (k) {
+    case LayoutKind::Stack: return "stack";
+    case LayoutKind::Grid: return "grid";
+    case LayoutKind::Flow: return "flow";
+    case LayoutKind::Dock: return "dock";
+    case LayoutKind::Absolute: return "absolute";
+    }
+    return "?";
+}
+
+static const char* shapeName(Shape s) {
+    switch (s) {
+    case Shape::Deep: return "deep";
+    case Shape::Wide: return "wide";
+    case Shape::Mixed: return "mixed";
+    case Shape::Cards: return "cards";
+    }
+    return "?";
+}
+
+static const char* slotName(Slot s) { return s == Slot::Virtual ? "virtual" : "inline"; }
+
+// ---------- tree generation ----------
+struct TreeGen {
+    LayoutKind kind;
+    Slot slot;
+    size_t budget;     // nodes still to create
+    size_t created = 0;
+    size_t leafIndex = 0;
+
+    // container with n children (n decided by the caller); the layout gets
+    // dock entries / absolute positions once the children exist
+    WidgetBuilder container(size_t expectedChildren) {
+        WidgetBuilder b = slot == Slot::Inline ? WB<LayoutPanel>() : WB<Panel>();
+        ++created;
+        switch (kind) {
+        case LayoutKind::Stack: setLayout<StackLayout>(b); break;
+        case LayoutKind::Grid: {
+            int cols = std::max(1, (int)std::ceil(std::sqrt((double)std::max<size_t>(1, expectedChildren))));
+            int rows = std::max(1, (int)((expectedChildren + cols - 1) / cols));
+            setLayout<GridLayout>(b, rows, cols);
+            break;
+        }
+        case LayoutKind::Flow: setLayout<FlowLayout>(b); break;
+        case LayoutKind::Dock: setLayout<DockLayout>(b); break;
+        case LayoutKind::Absolute: setLayout<AbsoluteLayout>(b); break;
+        }
+        return b;
+    }
+
+    template <class L, class... Args>
+    void setLayout(WidgetBuilder& b, Args... args) {
+        if (slot == Slot::Inline) b.init<LayoutPanel>([&](LayoutPanel& p) { p.setLayout<L>(args...); });
+        else b.layout(std::make_unique<L>(args...));
+    }
+
+    std::unique_ptr<Widget> leaf(bool text) {
+        ++created;
+        size_t i = leafIndex++;
+        std::unique_ptr<Widget> w;
+        if (text) w = std::make_unique<Label>(L"item " + std::to_wstring(i));
+        else {
+            w = std::make_unique<Widget>();
+            w->setFixedSize(20 + (double)(i % 5) * 4, 16);
+        }
+        if (i % 7 == 0) w->setFocusable(true);
+        if (kind == LayoutKind::Absolute) {
+            w->rect.x = (double)(i * 37 % 1900);
+            w->rect.y = (double)(i * 53 % 1000);
+        }
+        return w;
+    }
+
+    static void finish(Widget* w, LayoutKind kind) {
+        if (kind != LayoutKind::Dock) return;
+        auto* inl = dynamic_cast<LayoutPanel*>(w);
+        auto* dock = inl ? inl->layoutAs<DockLayout>() : static_cast<DockLayout*>(w->layout.get());
+        static const Dock order[] = { Dock::Top, Dock::Left, Dock::Bottom, Dock::Right };
+        for (size_t i = 0; i < w->children.size(); ++i) {
+            bool last = i + 1 == w->children.size();
+            dock->addDockedWidget(w->children[i].get(), last ? Dock::Fill : order[i % 4]);
+        }
+    }
+
+    std::unique_ptr<Widget> build(WidgetBuilder& b) {
+        auto w = b.build();
+        finish(w.get(), kind);
+        return w;
+    }
+
+    // root with (n - 1) leaves
+    std::unique_ptr<Widget> wide() {
+        WidgetBuilder root = container(budget - 1);
+        while (created < budget) root.addChild(leaf(false));
+        return build(root);
+    }
+
+    // chains of nested containers, each level: one leaf + the next level
+    std::unique_ptr<Widget> deep(size_t maxDepth = 256) {
+        size_t chains = std::max<size_t>(1, (budget - 1 + 2 * maxDepth - 1) / (2 * maxDepth));
+        WidgetBuilder root = container(chains);
+        for (size_t c = 0; c < chains && created < budget; ++c) {
+            size_t left = (budget - created) / (chains - c);
+            size_t depth = std::max<size_t>(1, std::min(maxDepth, left / 2));
+            root.addChild(chain(depth));
+        }
+        return build(root);
+    }
+
+    std::unique_ptr<Widget> chain(size_t depth) {
+        WidgetBuilder b = container(2);
+        b.addChild(leaf(false));
+        if (depth > 1) b.addChild(chain(depth - 1));
+        return build(b);
+    }
+
+    // fanout 8 containers, leaves alternate plain widgets and labels
+    std::unique_ptr<Widget> mixed() {
+        // smallest depth with 8^depth >= budget; the last level stops at the budget
+        size_t depth = 1;
+        for (size_t n = 8; n < budget; n *= 8) ++depth;
+        return mixedLevel(depth);
+    }
+
+    // root with many small containers of 4 leaves: per-container cost dominates
+    std::unique_ptr<Widget> cards() {
+        WidgetBuilder root = container((budget - 1) / 5);
+        while (created + 5 <= budget) {
+            WidgetBuilder card = container(4);
+            for (int i = 0; i < 4; ++i) card.addChild(leaf(i % 2 == 1));
+            root.addChild(build(card));
+        }
+        return build(root);
+    }
+
+    std::unique_ptr<Widget> mixedLevel(size_t depth) {
+        WidgetBuilder b = container(8);
+        for (int i = 0; i < 8 && created < budget; ++i) {
+            if (depth > 1 && created + 9 <= budget) b.addChild(mixedLevel(depth - 1));
+            else b.addChild(leaf(i % 2 == 1));
+        }
+        return build(b);
+    }
+};
+
+static void collectLeaves(Widget* w, std::vector<Widget*>& out) {
+    if (w->children.empty()) out.push_back(w);
+    for (auto& c : w->children) collectLeaves(c.get(), out);
+}
+
+static void collectAll(Widget* w, std::vector<Widget*>& out) {
+    out.push_back(w);
+    for (auto& c : w->children) collectAll(c.get(), out);
+}
+
+// ---------- incremental vs full ----------
+// groups of cards under the root, every other card with a fixed size: relayout
+// boundaries below a clean container. Each frame edits a few labels inside and
+// outside those cards and resizes one card; after the incremental
+// performLayout every rect and measured size must equal a full layout of a
+// twin tree given the same edits.
+static std::unique_ptr<Widget> boundaryTree(LayoutKind kind, Slot slot, std::vector<Label*>& labels, std::vector<Widget*>& fixed) {
+    TreeGen gen{kind, slot, 1000};
+    WidgetBuilder root = gen.container(9);
+    for (int g = 0; g < 8; ++g) {
+        WidgetBuilder group = gen.container(6);
+        for (int c = 0; c < 5; ++c) {
+            WidgetBuilder card = gen.container(4);
+            for (int i = 0; i < 4; ++i) {
+                std::unique_ptr<Widget> w = gen.leaf(i % 2 == 0);
+                if (i % 2 == 0) labels.push_back(static_cast<Label*>(w.get()));
+                card.addChild(std::move(w));
+            }
+            std::unique_ptr<Widget> built = gen.build(card);
+            if (c % 2 == 0) {
+                built->setFixedSize(120 + c * 10, 70);
+                fixed.push_back(built.get());
+            }
+            group.addChild(std::move(built));
+        }
+        std::unique_ptr<Widget> w = gen.leaf(true);
+        labels.push_back(static_cast<Label*>(w.get()));
+        group.addChild(std::move(w));
+        root.addChild(gen.build(group));
+    }
+    return gen.build(root);
+}
+
+static bool incrementalMatchesFull(LayoutKind kind, Slot slot) {
+    const LayoutConstraints screen{0, 0, 1920, 1080};
+    std::vector<Label*> la, lb;
+    std::vector<Widget*> fa, fb;
+    WidgetManager inc(boundaryTree(kind, slot, la, fa), nullptr);
+    WidgetManager full(boundaryTree(kind, slot, lb, fb), nullptr);
+    inc.performLayout(screen);
+    full.performLayout(screen);
+
+    std::vector<Widget*> a, b;
+    collectAll(inc.root.get(), a);
+    collectAll(full.root.get(), b);
+    std::mt19937 rng(777);
+    for (int frame = 0; frame < 40; ++frame) {
+        for (int e = 0; e < 3; ++e) {
+            size_t i = rng() % la.size();
+            std::wstring text(1 + rng() % 30, L'x');
+            la[i]->setText(text);
+            lb[i]->setText(text);
+        }
+        // a resized card moves whatever follows it, boundaries included
+        size_t f = rng() % fa.size();
+        double w = 100 + rng() % 60, h = 50 + rng() % 40;
+        fa[f]->setFixedSize(w, h);
+        fb[f]->setFixedSize(w, h);
+        inc.performLayout(screen);
+        for (Widget* w : b) w->invalidateMeasureCache();
+        full.laidOut = false;
+        full.performLayout(screen);
+        for (size_t i = 0; i < a.size(); ++i) {
+            const Widget& x = *a[i];
+            const Widget& y = *b[i];
+            if (!(x.rect == y.rect) || x.meansureSize.w != y.meansureSize.w || x.meansureSize.h != y.meansureSize.h ||
+                x.isLayoutDirty())
+                return false;
+        }
+    }
+    return true;
+}
+
+// ---------- measurement ----------
+struct Result {
+    LayoutKind kind;
+    Shape shape;
+    Slot slot;
+    size_t nodes;
+    double buildMs, layoutMs, fullRelayoutMs, relayoutMs, hitTestNs, focusMs, teardownMs;
+    size_t focusable;
+};
+
+static Result run(LayoutKind kind, Shape shape, Slot slot, size_t nodes) {
+    Result r{kind, shape, slot, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    const LayoutConstraints screen{0, 0, 1920, 1080};
+
+    auto t0 = Clock::now();
+    TreeGen gen{kind, slot, nodes};
+    std::unique_ptr<Widget> root = shape == Shape::Deep ? gen.deep()
+                                 : shape == Shape::Wide ? gen.wide()
+                                 : shape == Shape::Cards ? gen.cards()
+                                                         : gen.mixed();
+    r.buildMs = msSince(t0);
+    r.nodes = gen.created;
+
+    WidgetManager wm(std::move(root), nullptr);
+
+    t0 = Clock::now();
+    wm.performLayout(screen);
+    r.layoutMs = msSince(t0);
+
+    // warm full passes: every measure cache is dropped (untimed) so each widget
+    // is re-measured and re-arranged; a new root width makes performLayout()
+    // start at the root. Width alone isn't enough: flow/absolute subtrees
+    // whose constraints don't depend on it would be answered from the caches.
+    std::vector<Widget*> all;
+    collectAll(wm.root.get(), all);
+    const int fulls = 6;
+    double fullMs = 0;
+    for (int i = 1; i <= fulls; ++i) {
+        for (Widget* w : all) w->invalidateMeasureCache();
+        t0 = Clock::now();
+        wm.performLayout({ 0, 0, 1920.0 - i, 1080 });
+        fullMs += msSince(t0);
+    }
+    r.fullRelayoutMs = fullMs / fulls;
+    wm.performLayout(screen);
+
+    // one container in the middle of the tree changes: incremental relayout
+    std::vector<Widget*> leaves;
+    collectLeaves(wm.root.get(), leaves);
+    Widget* victim = leaves[leaves.size() / 2]->parent;
+    const int relayouts = 20;
+    t0 = Clock::now();
+    for (int i = 0; i < relayouts; ++i) {
+        victim->markLayoutDirty();
+        wm.performLayout(screen);
+    }
+    r.relayoutMs = msSince(t0) / relayouts;
+
+    std::mt19937 rng(12345);
+    const int hits = 20000;
+    volatile size_t found = 0;
+    t0 = Clock::now();
+    for (int i = 0; i < hits; ++i) {
+        if (wm.hitTest((int)(rng() % 1920), (int)(rng() % 1080))) found = found + 1;
+    }
+    r.hitTestNs = msSince(t0) * 1e6 / hits;
+
+    std::vector<Widget*> focus;
+    const int focusRuns = 5;
+    t0 = Clock::now();
+    for (int i = 0; i < focusRuns; ++i) {
+        focus.clear();
+        wm.root->collectFocusable(focus);
+    }
+    r.focusMs = msSince(t0) / focusRuns;
+    r.focusable = focus.size();
+
+    t0 = Clock::now();
+    wm.root.reset();
+    r.teardownMs = msSince(t0);
+    return r;
+}
+
+int main(int argc, char** argv) {
+    size_t minNodes = 1000, maxNodes = 1000000;
+    std::string onlyLayout, onlyShape, onlySlot, outPath;
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : ""; };
+        if (!std::strcmp(argv[i], "--quick")) maxNodes = 1000;
+        else if (!std::strcmp(argv[i], "--max-nodes")) maxNodes = std::strtoull(next(), nullptr, 10);
+        else if (!std::strcmp(argv[i], "--min-nodes")) minNodes = std::strtoull(next(), nullptr, 10);
+        else if (!std::strcmp(argv[i], "--layout")) onlyLayout = next();
+        else if (!std::strcmp(argv[i], "--shape")) onlyShape = next();
+        else if (!std::strcmp(argv[i], "--slot")) onlySlot = next();
+        else if (!std::strcmp(argv[i], "--out")) outPath = next();
+        else {
+            std::fprintf(stderr, "usage: %s [--quick] [--max-nodes N] [--min-nodes N] [--layout NAME] [--shape NAME] [--slot NAME] [--out FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    StubTextMeasurer stub;
+    setTextMeasurer(&stub);
+
+    FILE* out = outPath.empty() ? stdout : std::fopen(outPath.c_str(), "w");
+    if (!out) {
+        std::perror(outPath.c_str());
+        return 1;
+    }
+
+    std::fprintf(out, "{\n  \"benchmark\": \"layout\",\n  \"unit\": {\"time\": \"ms\", \"hit_test\": \"ns/query\"},\n  \"results\": [");
+    bool first = true;
+    const LayoutKind kinds[] = { LayoutKind::Stack, LayoutKind::Grid, LayoutKind::Flow, LayoutKind::Dock, LayoutKind::Absolute };
+    const Shape shapes[] = { Shape::Deep, Shape::Wide, Shape::Mixed, Shape::Cards };
+    const Slot slots[] = { Slot::Virtual, Slot::Inline };
+    for (size_t n = minNodes; n <= maxNodes; n *= 10) {
+        for (LayoutKind k : kinds) {
+            if (!onlyLayout.empty() && onlyLayout != layoutName(k)) continue;
+            for (Shape s : shapes) {
+                if (!onlyShape.empty() && onlyShape != shapeName(s)) continue;
+                for (Slot sl : slots) {
+                    if (!onlySlot.empty() && onlySlot != slotName(sl)) continue;
+                    Result r = run(k, s, sl, n);
+                    std::fprintf(out, "%s\n    {\"layout\": \"%s\", \"shape\": \"%s\", \"slot\": \"%s\", \"nodes\": %zu, "
+                                      "\"build_ms\": %.3f, \"perform_layout_ms\": %.3f, \"full_relayout_ms\": %.3f, "
+                                      "\"relayout_ms\": %.4f, \"hit_test_ns\": %.1f, \"collect_focusable_ms\": %.4f, "
+                                      "\"focusable\": %zu, \"teardown_ms\": %.3f}",
+                                 first ? "" : ",", layoutName(k), shapeName(s), slotName(sl), r.nodes, r.buildMs,
+                                 r.layoutMs, r.fullRelayoutMs, r.relayoutMs, r.hitTestNs, r.focusMs, r.focusable,
+                                 r.teardownMs);
+                    std::fflush(out);
+                    first = false;
+                }
+            }
+        }
+    }
+    std::fprintf(out, "\n  ],\n  \"incremental_matches_full\": [");
+
+    bool allMatch = true;
+    first = true;
+    for (LayoutKind k : kinds) {
+        if (!onlyLayout.empty() && onlyLayout != layoutName(k)) continue;
+        for (Slot sl : slots) {
+            if (!onlySlot.empty() && onlySlot != slotName(sl)) continue;
+            bool same = incrementalMatchesFull(k, sl);
+            allMatch &= same;
+            std::fprintf(out, "%s\n    {\"layout\": \"%s\", \"slot\": \"%s\", \"matches\": %s}",
+                         first ? "" : ",", layoutName(k), slotName(sl), same ? "true" : "false");
+            first = false;
+        }
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) std::fclose(out);
+    if (!allMatch) std::fprintf(stderr, "layout_bench: incremental layout differs from a full layout\n");
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+// Pixel kernel microbenchmark: fill / blend / copy / blendCopy / blendMask at several
+// surface sizes for every ISA the CPU supports, against the scalar kernels.
+// Every vector result is checked bit for bit against scalar; a mismatch makes
+// the run fail. A widget screen is also painted by TiledSoftwareRenderer at
+// several tile sizes and thread counts (--kernel tiled) and must match
+// SoftwareRenderer pixel for pixel; its damaged repaints must match a full
+// repaint. Results go to stdout (or --out FILE) as JSON.
+//
+//   pixel_bench [--quick] [--size NAME] [--kernel NAME] [--out FILE]
+#include "../widget.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <random>
+
+using Clock = std::chrono::steady_clock;
+
+struct SurfaceSize {
+    const char* name;
+    int w, h;
+};
+
+static const SurfaceSize sizes[] = {
+    { "4k", 3840, 2160 },
+    { "1080p", 1920, 1080 },
+    { "panel", 320, 240 },       // typical widget background
+    { "row", 1917, 1 },          // odd width: exercises the scalar tails
+};
+
+enum class Op { Fill, Blend, Copy, BlendCopy, BlendMask };
+static const char* opName(Op op) {
+    switch (op) {
+    case Op::Fill: return "fill";
+    case Op::Blend: return "blend";
+    case Op::Copy: return "copy";
+    case Op::BlendCopy: return "blend_copy";
+    case Op::BlendMask: return "blend_mask";
+    }
+    return "";
+}
+
+static void randomize(std::vector<uint32_t>& px, uint32_t seed) {
+    std::mt19937 rng(seed);
+    for (uint32_t& p : px) p = rng();
+}
+
+// glyph-like coverage: mostly empty or solid, antialiased edges in between
+static std::vector<uint8_t> coverageMask(size_t n, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> m(n);
+    for (uint8_t& v : m) {
+        uint32_t r = rng() % 8;
+        v = r < 4 ? 0 : r < 6 ? 255 : (uint8_t)rng();
+    }
+    return m;
+}
+
+static void runOp(const PixelKernels& k, Op op, std::vector<uint32_t>& dst, const std::vector<uint32_t>& src,
+                  const std::vector<uint8_t>& mask, int w, int h) {
+    switch (op) {
+    case Op::Fill: k.fill(dst.data(), w, w, h, Color::rgb(240, 240, 240).packed()); break;
+    case Op::Blend: k.blend(dst.data(), w, w, h, Color::rgba(30, 120, 200, 96)); break;
+    case Op::Copy: k.copy(dst.data(), w, src.data(), w, w, h); break;
+    case Op::BlendCopy: k.blendCopy(dst.data(), w, src.data(), w, w, h); break;
+    case Op::BlendMask: k.blendMask(dst.data(), w, mask.data(), w, w, h, Color::rgba(20, 20, 20, 230)); break;
+    }
+}
+
+// translucent cards of labels, a fixed-size card whose rows overflow it and a
+// scrolled, clipped panel: fills, blends, text and clips that straddle tile edges
+struct TiledScene {
+    std::unique_ptr<Widget> root;
+    Label* changing = nullptr;
+    Label* overflowing = nullptr;   // drawn below its parent's rect
+};
+
+static TiledScene tiledScene(int w, int h) {
+    TiledScene s;
+    auto root = std::make_unique<Panel>();
+    root->setFixedSize(w, h);   // a window's root: nothing outside it is repainted
+    root->layout = std::make_unique<FlowLayout>();
+    for (int c = 0; c < 48; ++c) {
+        auto card = std::make_unique<Panel>();
+        card->layout = std::make_unique<StackLayout>();
+        card->setBackground(Color::rgba(30, (uint8_t)(60 + c * 3), 200, 110));
+        for (int i = 0; i < 10; ++i) {
+            auto l = std::make_unique<Label>(L"item " + std::to_wstring(c * 10 + i));
+            if (c == 7 && i == 3) s.changing = l.get();
+            card->addChild(std::move(l));
+        }
+        root->addChild(std::move(card));
+        if (c == 20) {
+            auto small = std::make_unique<Panel>();
+            small->setFixedSize(140, 24);
+            small->layout = std::make_unique<StackLayout>();
+            for (int i = 0; i < 4; ++i) {
+                auto l = std::make_unique<Label>(L"overflow " + std::to_wstring(i));
+                l->getStyle().setBgColor(Color::rgb(250, 250, 250));
+                if (i == 2) s.overflowing = l.get();
+                small->addChild(std::move(l));
+            }
+            root->addChild(std::move(small));
+        }
+    }
+    auto scroll = std::make_unique<ScrollPanel>();
+    scroll->setFixedSize(230, 150);
+    scroll->layout = std::make_unique<StackLayout>();
+    for (int i = 0; i < 30; ++i) scroll->addChild(std::make_unique<Label>(L"scrolled row " + std::to_wstring(i)));
+    scroll->scroll(37);
+    root->addChild(std::move(scroll));
+    s.root = std::move(root);
+    return s;
+}
+
+// paints a full frame, then two damaged frames (one label changes text, then
+// an overflowing row its background); false if any frame differs from the
+// serial renderer, or the last damaged serial frame from a full repaint. ms is
+// one full tiled repaint.
+static bool tiledMatches(int w, int h, int tile, int threads, int reps, double& serialMs, double& tiledMs) {
+    TaskPool pool(threads);
+    Framebuffer fs(w, h), ft(w, h);
+    SoftwareRenderer serial(fs);
+    TiledSoftwareRenderer tiled(ft, tile, &pool);
+    TiledScene a = tiledScene(w, h), b = tiledScene(w, h);
+    Label* la = a.changing;
+    Label* lb = b.changing;
+    Label* oa = a.overflowing;
+    Label* ob = b.overflowing;
+    WidgetManager ms(std::move(a.root), &serial), mt(std::move(b.root), &tiled);
+    LayoutConstraints screen{ 0, 0, (double)w, (double)h };
+    auto frame = [&] {
+        ms.performLayout(screen);
+        ms.render();
+        mt.performLayout(screen);
+        mt.render();
+        return fs.pixels == ft.pixels;
+    };
+    bool same = frame();
+    la->setText(L"changed text");
+    lb->setText(L"changed text");
+    same &= frame();
+    oa->getStyle().setBgColor(Color::rgb(200, 40, 40));
+    ob->getStyle().setBgColor(Color::rgb(200, 40, 40));
+    same &= frame();
+
+    // the same frame repainted in full on a blank target
+    Framebuffer fr(w, h);
+    serial.setTarget(fr);
+    ms.invalidateAll();
+    ms.render();
+    serial.setTarget(fs);
+    same &= fr.pixels == fs.pixels;
+
+    auto time = [&](WidgetManager& m) {
+        auto t0 = Clock::now();
+        for (int r = 0; r < reps; ++r) {
+            m.invalidateAll();
+            m.render();
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / reps;
+    };
+    serialMs = time(ms);
+    tiledMs = time(mt);
+    return same && fs.pixels == ft.pixels;
+}
+
+int main(int argc, char** argv) {
+    bool quick = false;
+    std::string onlySize, onlyKernel, outPath;
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : ""; };
+        if (!std::strcmp(argv[i], "--quick")) quick = true;
+        else if (!std::strcmp(argv[i], "--size")) onlySize = next();
+        else if (!std::strcmp(argv[i], "--kernel")) onlyKernel = next();
+        else if (!std::strcmp(argv[i], "--out")) outPath = next();
+        else {
+            std::fprintf(stderr, "usage: %s [--quick] [--size NAME] [--kernel NAME] [--out FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    FILE* out = outPath.empty() ? stdout : std::fopen(outPath.c_str(), "w");
+    if (!out) {
+        std::perror(outPath.c_str());
+        return 1;
+    }
+
+    std::vector<PixelIsa> isas = { PixelIsa::Scalar };
+    if (cpuSupports(PixelIsa::SSE2)) isas.push_back(PixelIsa::SSE2);
+    if (cpuSupports(PixelIsa::AVX2)) isas.push_back(PixelIsa::AVX2);
+
+    std::fprintf(out, "{\n  \"benchmark\": \"pixel\",\n  \"best\": \"%s\",\n  \"unit\": {\"time\": \"ms/op\", \"rate\": \"Mpixel/s\"},\n  \"results\": [",
+                 pixelKernels(bestPixelIsa()).name);
+    bool first = true, mismatch = false;
+    const Op ops[] = { Op::Fill, Op::Blend, Op::Copy, Op::BlendCopy, Op::BlendMask };
+    for (const SurfaceSize& sz : sizes) {
+        if (!onlySize.empty() && onlySize != sz.name) continue;
+        if (quick && sz.w * sz.h > 1920 * 1080) continue;
+        size_t n = (size_t)sz.w * sz.h;
+        std::vector<uint32_t> src(n), dst(n), start(n), expect(n);
+        randomize(src, 1);
+        randomize(start, 2);
+        std::vector<uint8_t> mask = coverageMask(n, 3);
+
+        for (Op op : ops) {
+            if (!onlyKernel.empty() && onlyKernel != opName(op)) continue;
+            // scalar result is the reference for every ISA
+            expect = start;
+            runOp(pixelKernels(PixelIsa::Scalar), op, expect, src, mask, sz.w, sz.h);
+
+            double scalarMs = 0;
+            for (PixelIsa isa : isas) {
+                const PixelKernels& k = pixelKernels(isa);
+                dst = start;
+                runOp(k, op, dst, src, mask, sz.w, sz.h);
+                bool same = dst == expect;
+                mismatch |= !same;
+
+                // enough repetitions for ~64 Mpixel per measurement (fewer in quick mode)
+                int reps = (int)std::max<size_t>(1, (quick ? (1u << 22) : (1u << 26)) / n);
+                auto t0 = Clock::now();
+                for (int r = 0; r < reps; ++r) runOp(k, op, dst, src, mask, sz.w, sz.h);
+                double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / reps;
+                if (isa == PixelIsa::Scalar) scalarMs = ms;
+
+                std::fprintf(out, "%s\n    {\"size\": \"%s\", \"width\": %d, \"height\": %d, \"kernel\": \"%s\", \"isa\": \"%s\", "
+                                  "\"ms\": %.4f, \"mpixel_s\": %.1f, \"speedup\": %.2f, \"matches_scalar\": %s}",
+                             first ? "" : ",", sz.name, sz.w, sz.h, opName(op), k.name, ms, n / ms / 1000.0,
+                             ms > 0 ? scalarMs / ms : 0.0, same ? "true" : "false");
+                std::fflush(out);
+                first = false;
+            }
+        }
+    }
+    std::fprintf(out, "\n  ],\n  \"tiled\": [");
+
+    // tiled renderer against the serial one, same screen
+    bool tiledMismatch = false;
+    if (onlyKernel.empty() || onlyKernel == "tiled") {
+        first = true;
+        for (const SurfaceSize& sz : sizes) {
+            if (!onlySize.empty() && onlySize != sz.name) continue;
+            if (quick && sz.w * sz.h > 1920 * 1080) continue;
+            for (int tile : { 32, 128, 333 }) {
+                for (int threads : { 0, 3 }) {
+                    double serialMs = 0, tiledMs = 0;
+                    bool same = tiledMatches(sz.w, sz.h, tile, threads, quick ? 2 : 20, serialMs, tiledMs);
+                    tiledMismatch |= !same;
+                    std::fprintf(out, "%s\n    {\"size\": \"%s\", \"tile\": %d, \"threads\": %d, \"serial_ms\": %.3f, "
+                                      "\"tiled_ms\": %.3f, \"speedup\": %.2f, \"matches_serial\": %s}",
+                                 first ? "" : ",", sz.name, tile, threads, serialMs, tiledMs,
+                                 tiledMs > 0 ? serialMs / tiledMs : 0.0, same ? "true" : "false");
+                    std::fflush(out);
+                    first = false;
+                }
+            }
+        }
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) std::fclose(out);
+    if (mismatch) std::fprintf(stderr, "pixel_bench: vector kernels differ from scalar\n");
+    if (tiledMismatch) std::fprintf(stderr, "pixel_bench: tiled renderer differs from SoftwareRenderer, or a damaged repaint from a full one\n");
+    return mismatch || tiledMismatch ? 1 : 0;
+}
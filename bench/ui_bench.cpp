@@ -0,0 +1,202 @@
+// Screen startup benchmark: an operator console (header, sidebar, grid of
+// cards with name/value rows) built imperatively with WidgetBuilder vs.
+// loaded from the binary UI format (compiled once, then mmap + build).
+// Both trees are laid out and compared rect by rect; a mismatch fails the
+// run. Results go to stdout (or --out FILE) as JSON.
+//
+//   ui_bench [--quick] [--cards N] [--rows N] [--out FILE]
+#include "../widget.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+static std::wstring widen(const std::string& s) { return std::wstring(s.begin(), s.end()); }
+
+static std::string rowName(int r) { return "sensor " + std::to_string(r); }
+static std::string rowValue(int c, int r) { return std::to_string((c * 31 + r * 7) % 1000) + ".5 bar"; }
+
+static std::string consoleSource(int cards, int rows) {
+    std::string s =
+        "style title { font=\"Segoe UI\" size=14 bold color=#202020 }\n"
+        "style value { size=9 color=#0050a0 }\n"
+        "Panel layout=dock background=#f0f0f0 {\n"
+        "  Label dock=top text=\"Operator console\" style=title padding=6\n"
+        "  Panel dock=left layout=stack spacing=2 padding=4 width=180 height=1000 {\n";
+    for (int i = 0; i < 20; ++i) s += "    Label text=\"view " + std::to_string(i) + "\" focusable\n";
+    s += "  }\n  Panel dock=fill layout=flow spacing=6 padding=6 {\n";
+    for (int c = 0; c < cards; ++c) {
+        s += "    Panel layout=grid columns=\"auto 1*\" rows=" + std::to_string(rows + 1) + " spacing=2 background=#ffffff {\n";
+        s += "      Label text=\"unit " + std::to_string(c) + "\" style=title row=0 col=0 colSpan=2\n";
+        for (int r = 0; r < rows; ++r) {
+            s += "      Label text=\"" + rowName(r) + "\" row=" + std::to_string(r + 1) + " col=0\n";
+            s += "      Label text=\"" + rowValue(c, r) + "\" style=value textAlign=right row=" + std::to_string(r + 1) + " col=1\n";
+        }
+        s += "    }\n";
+    }
+    s += "  }\n}\n";
+    return s;
+}
+
+static std::unique_ptr<Widget> consoleBuilder(int cards, int rows) {
+    TextStyle title(L"Segoe UI", 14);
+    title.setBold(true);
+    title.setTextColor(Color::rgb(0x20, 0x20, 0x20));
+    TextStyle value(L"Segoe UI", 9);
+    value.setTextColor(Color::rgb(0x00, 0x50, 0xa0));
+
+    auto root = std::make_unique<Panel>();
+    root->layout = std::make_unique<DockLayout>();
+    auto* dock = static_cast<DockLayout*>(root->layout.get());
+
+    auto header = std::make_unique<Label>(L"Operator console", title);
+    header->setPadding(6);
+    dock->addDockedWidget(header.get(), Dock::Top);
+    root->addChild(std::move(header));
+
+    auto side = WB<Panel>();
+    side.init<Panel>([](Panel& p) {
+        auto l = std::make_unique<StackLayout>();
+        l->spacing = 2;
+        l->padding = 4;
+        p.layout = std::move(l);
+        p.setFixedSize(180, 1000);
+    });
+    for (int i = 0; i < 20; ++i) {
+        auto l = std::make_unique<Label>(L"view " + std::to_wstring(i));
+        l->setFocusable(true);
+        side.addChild(std::move(l));
+    }
+    auto sideW = side.build();
+    dock->addDockedWidget(sideW.get(), Dock::Left);
+    root->addChild(std::move(sideW));
+
+    auto body = std::make_unique<Panel>();
+    auto flow = std::make_unique<FlowLayout>();
+    flow->spacing = 6;
+    flow->padding = 6;
+    body->layout = std::move(flow);
+    for (int c = 0; c < cards; ++c) {
+        auto card = std::make_unique<Panel>();
+        card->setBackground(Color::rgb(255, 255, 255));
+        auto grid = std::make_unique<GridLayout>(rows + 1, 2);
+        grid->setColumns({ GridLength::autoSize(), GridLength::star() });
+        grid->spacing = 2;
+        GridLayout* g = grid.get();
+        card->layout = std::move(grid);
+        auto head = std::make_unique<Label>(L"unit " + std::to_wstring(c), title);
+        g->place(head.get(), 0, 0, 1, 2);
+        card->addChild(std::move(head));
+        for (int r = 0; r < rows; ++r) {
+            auto name = std::make_unique<Label>(widen(rowName(r)));
+            g->place(name.get(), r + 1, 0);
+            card->addChild(std::move(name));
+            auto val = std::make_unique<Label>(widen(rowValue(c, r)), value);
+            val->setHAlign(Label::HAlign::Right);
+            g->place(val.get(), r + 1, 1);
+            card->addChild(std::move(val));
+        }
+        body->addChild(std::move(card));
+    }
+    dock->addDockedWidget(body.get(), Dock::Fill);
+    root->addChild(std::move(body));
+    return root;
+}
+
+static size_t countNodes(const Widget* w) {
+    size_t n = 1;
+    for (auto& c : w->children) n += countNodes(c.get());
+    return n;
+}
+
+static bool sameRects(const Widget* a, const Widget* b) {
+    if (a->children.size() != b->children.size() || a->rect.x != b->rect.x || a->rect.y != b->rect.y
+        || a->rect.w != b->rect.w || a->rect.h != b->rect.h)
+        return false;
+    for (size_t i = 0; i < a->children.size(); ++i)
+        if (!sameRects(a->children[i].get(), b->children[i].get())) return false;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int cards = 2000, rows = 8;
+    std::string outPath;
+    for (int i = 1; i < argc; ++i) {
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : "0"; };
+        if (!std::strcmp(argv[i], "--quick")) cards = 50;
+        else if (!std::strcmp(argv[i], "--cards")) cards = std::atoi(next());
+        else if (!std::strcmp(argv[i], "--rows")) rows = std::atoi(next());
+        else if (!std::strcmp(argv[i], "--out")) outPath = next();
+        else {
+            std::fprintf(stderr, "usage: %s [--quick] [--cards N] [--rows N] [--out FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::string source = consoleSource(cards, rows);
+    auto t0 = Clock::now();
+    UiCompileResult compiled = UiCompiler::compile(source);
+    double compileMs = msSince(t0);
+    if (!compiled.ok()) {
+        std::fprintf(stderr, "ui_bench: line %d: %s\n", compiled.line, compiled.error.c_str());
+        return 1;
+    }
+    std::string path = "ui_bench_console.wui";
+    if (FILE* f = std::fopen(path.c_str(), "wb")) {
+        std::fwrite(compiled.bytes.data(), 1, compiled.bytes.size(), f);
+        std::fclose(f);
+    }
+
+    // best of a few runs: startup cost, not allocator warm-up, is the point
+    const int reps = 5;
+    double builderMs = 1e30, loadMs = 1e30, mapMs = 1e30;
+    std::unique_ptr<Widget> built, loaded;
+    for (int r = 0; r < reps; ++r) {
+        built.reset();
+        t0 = Clock::now();
+        built = consoleBuilder(cards, rows);
+        builderMs = std::min(builderMs, msSince(t0));
+
+        loaded.reset();
+        t0 = Clock::now();
+        UiFile file;
+        if (!file.open(path.c_str())) {
+            std::fprintf(stderr, "ui_bench: %s\n", file.error().c_str());
+            return 1;
+        }
+        mapMs = std::min(mapMs, msSince(t0));
+        loaded = file.build();
+        loadMs = std::min(loadMs, msSince(t0));
+        if (!loaded) {
+            std::fprintf(stderr, "ui_bench: %s\n", file.error().c_str());
+            return 1;
+        }
+    }
+    std::remove(path.c_str());
+
+    WidgetManager a(std::move(built), nullptr), b(std::move(loaded), nullptr);
+    a.performLayout({ 1920, 1080, 1920, 1080 });
+    b.performLayout({ 1920, 1080, 1920, 1080 });
+    bool same = sameRects(a.root.get(), b.root.get());
+
+    FILE* out = outPath.empty() ? stdout : std::fopen(outPath.c_str(), "w");
+    if (!out) {
+        std::perror(outPath.c_str());
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"benchmark\": \"ui_startup\",\n  \"unit\": {\"time\": \"ms\"},\n  \"results\": [\n"
+                      "    {\"cards\": %d, \"rows\": %d, \"nodes\": %zu, \"file_bytes\": %zu, \"compile_ms\": %.3f, "
+                      "\"builder_ms\": %.3f, \"map_ms\": %.4f, \"load_ms\": %.3f, \"speedup\": %.2f, \"same_layout\": %s}\n  ]\n}\n",
+                 cards, rows, countNodes(b.root.get()), compiled.bytes.size(), compileMs, builderMs, mapMs, loadMs,
+                 loadMs > 0 ? builderMs / loadMs : 0.0, same ? "true" : "false");
+    if (out != stdout) std::fclose(out);
+    if (!same) std::fprintf(stderr, "ui_bench: loaded tree differs from the builder tree\n");
+    return same ? 0 : 1;
+}
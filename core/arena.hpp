@@ -0,0 +1,164 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+// -------------------------------
+// WidgetArena: bump allocator for widgets and layouts of one screen.
+// While a WidgetArena::Scope is active on a thread, every Widget/Layout
+// created with new/make_unique (WidgetBuilder, WB<T>...) is carved out of the
+// arena's chunks, and so are the child lists of those widgets. Deleting such
+// an object runs its destructor but frees nothing. The memory goes back in
+// one step, chunk by chunk, in reset() or when the arena is destroyed - the
+// tree must be gone by then.
+//
+// What stays on the heap: members widgets allocate themselves (label text,
+// std::function callbacks, text layouts). Destroying the tree still visits
+// every node to run its destructor; only the per-node frees are skipped.
+class WidgetArena {
+public:
+    struct Stats {
+        uint64_t allocations = 0;    // objects carved out of the arena
+        uint64_t releases = 0;       // deletes turned into no-ops
+        uint64_t bytesAllocated = 0; // requested, including headers
+        uint64_t bytesReserved = 0;  // chunk memory currently held
+        uint64_t peakReserved = 0;
+        uint64_t chunks = 0;
+        uint64_t resets = 0;
+        uint64_t live() const { return allocations - releases; }
+    };
+
+    static constexpr size_t ALIGN = alignof(std::max_align_t);
+
+private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks;
+    std::byte* cur = nullptr;
+    size_t left = 0;
+    size_t nextChunk;
+    size_t maxChunk;
+    Stats counters;
+
+public:
+    explicit WidgetArena(size_t firstChunk = 64 * 1024, size_t maxChunkSize = 1024 * 1024)
+        : nextChunk(firstChunk), maxChunk(std::max(firstChunk, maxChunkSize)) {}
+
+    WidgetArena(const WidgetArena&) = delete;
+    WidgetArena& operator=(const WidgetArena&) = delete;
+
+    void* allocate(size_t n) {
+        n = (n + ALIGN - 1) & ~(ALIGN - 1);
+        if (n > left) grow(n);
+        void* p = cur;
+        cur += n;
+        left -= n;
+        ++counters.allocations;
+        counters.bytesAllocated += n;
+        return p;
+    }
+
+    // memory is only reclaimed by reset()
+    void release(void*) { ++counters.releases; }
+
+    // drop every chunk at once; objects still allocated here become invalid
+    void reset() {
+        chunks.clear();
+        cur = nullptr;
+        left = 0;
+        counters.bytesReserved = 0;
+        counters.chunks = 0;
+        ++counters.resets;
+    }
+
+    const Stats& stats() const { return counters; }
+
+    // --- thread's current arena ---
+    static WidgetArena*& current() {
+        thread_local WidgetArena* a = nullptr;
+        return a;
+    }
+
+    // routes Widget/Layout allocations on this thread to an arena while alive
+    class Scope {
+        WidgetArena* prev;
+    public:
+        explicit Scope(WidgetArena& a) : prev(current()) { current() = &a; }
+        ~Scope() { current() = prev; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    void grow(size_t need) {
+        size_t size = std::max(need, nextChunk);
+        nextChunk = std::min(nextChunk * 2, maxChunk);
+        chunks.push_back({ std::make_unique<std::byte[]>(size), size });
+        cur = chunks.back().data.get();
+        left = size;
+        ++counters.chunks;
+        counters.bytesReserved += size;
+        counters.peakReserved = std::max(counters.peakReserved, counters.bytesReserved);
+    }
+};
+
+// -------------------------------
+// ArenaAllocated: class-level new/delete for Widget and Layout. Each block
+// starts with a small header naming its arena (or none), so objects from the
+// heap and from arenas can be mixed in one tree.
+struct ArenaAllocated {
+    static void* operator new(size_t n) {
+        constexpr size_t H = WidgetArena::ALIGN;
+        WidgetArena* a = WidgetArena::current();
+        std::byte* p = static_cast<std::byte*>(a ? a->allocate(n + H) : ::operator new(n + H));
+        *reinterpret_cast<WidgetArena**>(p) = a;
+        return p + H;
+    }
+
+    static void operator delete(void* ptr) {
+        if (!ptr) return;
+        std::byte* p = static_cast<std::byte*>(ptr) - WidgetArena::ALIGN;
+        if (WidgetArena* a = *reinterpret_cast<WidgetArena**>(p)) a->release(p);
+        else ::operator delete(p);
+    }
+};
+
+// -------------------------------
+// ArenaAllocator: allocator for containers owned by arena-allocated objects
+// (Widget::children). It takes the thread's current arena when the
+// container is created and keeps growing there, or uses the heap when there
+// is none.
+template <class T>
+struct ArenaAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    WidgetArena* arena;
+
+    ArenaAllocator() noexcept : arena(WidgetArena::current()) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& o) noexcept : arena(o.arena) {}
+
+    // a copied container belongs to whoever is being built now
+    ArenaAllocator select_on_container_copy_construction() const { return {}; }
+
+    T* allocate(size_t n) {
+        size_t bytes = n * sizeof(T);
+        return static_cast<T*>(arena ? arena->allocate(bytes) : ::operator new(bytes));
+    }
+    void deallocate(T* p, size_t) noexcept {
+        if (arena) arena->release(p);
+        else ::operator delete(p);
+    }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& o) const noexcept { return arena == o.arena; }
+};
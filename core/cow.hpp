@@ -0,0 +1,33 @@
+#pragma once
+#include <memory>
+#include <utility>
+
+// -------------------------------
+// Cow<T>: copy-on-write value. Copies share one immutable T; write() makes a
+// private copy first when the value is shared. Used for the parts of a
+// widget that clones of a prototype rarely change (label text, styles).
+template <typename T>
+class Cow {
+    std::shared_ptr<T> p;
+
+public:
+    Cow() : p(std::make_shared<T>()) {}
+    Cow(T v) : p(std::make_shared<T>(std::move(v))) {}
+
+    const T& get() const { return *p; }
+    const T& operator*() const { return *p; }
+    const T* operator->() const { return p.get(); }
+
+    // mutable access; detaches from the other copies first
+    T& write() {
+        if (p.use_count() != 1) p = std::make_shared<T>(*p);
+        return *p;
+    }
+
+    Cow& operator=(T v) {
+        p = std::make_shared<T>(std::move(v));
+        return *this;
+    }
+
+    bool sharesWith(const Cow& o) const { return p == o.p; }
+};
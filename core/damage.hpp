@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include "layout.hpp"
+
+// -------------------------------
+// DamageRegion: small list of window-space rects that need repaint.
+// Overlapping rects are merged; past maxRects the cheapest pair is merged
+// so the list (and the number of repaint passes) stays bounded.
+class DamageRegion {
+    std::vector<Rect> list;
+
+public:
+    size_t maxRects = 8;
+
+    const std::vector<Rect>& rects() const { return list; }
+    bool empty() const { return list.empty(); }
+    void clear() { list.clear(); }
+
+    Rect bounds() const {
+        Rect b{0, 0, 0, 0};
+        for (const Rect& r : list) b = b.united(r);
+        return b;
+    }
+
+    void add(Rect r) {
+        if (r.empty()) return;
+        // merge with everything it overlaps until stable
+        for (size_t i = 0; i < list.size();) {
+            if (list[i].containsRect(r)) return;
+            if (list[i].intersects(r)) {
+                r = r.united(list[i]);
+                list[i] = list.back();
+                list.pop_back();
+                i = 0;
+                continue;
+            }
+            ++i;
+        }
+        list.push_back(r);
+        while (list.size() > maxRects) mergeCheapestPair();
+    }
+
+    void add(const DamageRegion& o) {
+        for (const Rect& r : o.list) add(r);
+    }
+
+private:
+    void mergeCheapestPair() {
+        size_t bi = 0, bj = 1;
+        double best = -1;
+        for (size_t i = 0; i < list.size(); ++i) {
+            for (size_t j = i + 1; j < list.size(); ++j) {
+                Rect u = list[i].united(list[j]);
+                double growth = u.area() - list[i].area() - list[j].area();
+                if (best < 0 || growth < best) { best = growth; bi = i; bj = j; }
+            }
+        }
+        Rect u = list[bi].united(list[bj]);
+        list[bj] = list.back();
+        list.pop_back();
+        list[bi] = u;
+        // the merged rect may now overlap others
+        Rect m = list[bi];
+        list[bi] = list.back();
+        list.pop_back();
+        add(m);
+    }
+};
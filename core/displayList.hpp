@@ -0,0 +1,207 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdio>
+#include <cmath>
+#include "renderer.hpp"
+
+// -------------------------------
+// DisplayList: retained draw commands of one widget subtree, in window
+// coordinates at record time. Clean child subtrees are referenced (with an
+// offset) instead of copied, so re-recording a parent costs one command per
+// clean child. replay() culls commands outside the target's clip.
+class DisplayList {
+public:
+    enum class Op : uint8_t { Fill, Line, PushClip, PopClip, Text, List };
+
+    struct Command {
+        Op op;
+        Color color;
+        Rect box;          // Line: (x0, y0, x1, y1)
+        uint32_t index;    // Text: texts[index], List: lists[index]
+        int dx, dy;        // List: offset applied to the child list
+    };
+
+    struct TextRun {
+        std::wstring text;
+        FontRef font;
+        TextFormat fmt;
+        std::shared_ptr<const TextLayout> layout;   // may be null
+    };
+
+    std::vector<Command> commands;
+    std::vector<TextRun> texts;
+    std::vector<std::shared_ptr<const DisplayList>> lists;
+    Rect bounds{0, 0, 0, 0};   // union of everything drawn (clips ignored)
+
+    bool empty() const { return commands.empty(); }
+
+    void replay(Renderer& r, double dx = 0, double dy = 0) const {
+        Rect clip = r.clipBounds();
+        if (!offsetRect(bounds, dx, dy).intersects(clip)) return;
+        for (const Command& c : commands) {
+            switch (c.op) {
+            case Op::Fill: {
+                Rect b = offsetRect(c.box, dx, dy);
+                if (b.intersects(clip)) r.fillRect(b, c.color);
+                break;
+            }
+            case Op::Line:
+                r.drawLine(c.box.x + dx, c.box.y + dy, c.box.w + dx, c.box.h + dy, c.color);
+                break;
+            case Op::PushClip:
+                r.pushClip(offsetRect(c.box, dx, dy));
+                clip = r.clipBounds();
+                break;
+            case Op::PopClip:
+                r.popClip();
+                clip = r.clipBounds();
+                break;
+            case Op::Text: {
+                Rect b = offsetRect(c.box, dx, dy);
+                if (!b.intersects(clip)) break;
+                const TextRun& t = texts[c.index];
+                r.drawText(b, t.text, *t.font, c.color, t.fmt, t.layout.get());
+                break;
+            }
+            case Op::List:
+                r.drawList(lists[c.index], dx + c.dx, dy + c.dy);
+                break;
+            }
+        }
+    }
+
+    // flattened text form (child lists inlined), one command per line - for
+    // diffing frames and golden files
+    std::string serialize(double dx = 0, double dy = 0) const {
+        std::string out;
+        serializeTo(out, dx, dy);
+        return out;
+    }
+
+    // commands after inlining child lists
+    size_t flatSize() const {
+        size_t n = 0;
+        for (const Command& c : commands) n += c.op == Op::List ? lists[c.index]->flatSize() : 1;
+        return n;
+    }
+
+private:
+    static Rect offsetRect(const Rect& r, double dx, double dy) { return { r.x + dx, r.y + dy, r.w, r.h }; }
+
+    void serializeTo(std::string& out, double dx, double dy) const {
+        char buf[160];
+        auto color = [](Color c) { return (unsigned)c.r << 24 | (unsigned)c.g << 16 | (unsigned)c.b << 8 | c.a; };
+        for (const Command& c : commands) {
+            Rect b = offsetRect(c.box, dx, dy);
+            switch (c.op) {
+            case Op::Fill:
+                std::snprintf(buf, sizeof buf, "fill %g %g %g %g #%08x\n", b.x, b.y, b.w, b.h, color(c.color));
+                out += buf;
+                break;
+            case Op::Line:
+                std::snprintf(buf, sizeof buf, "line %g %g %g %g #%08x\n", b.x, b.y, c.box.w + dx, c.box.h + dy, color(c.color));
+                out += buf;
+                break;
+            case Op::PushClip:
+                std::snprintf(buf, sizeof buf, "clip %g %g %g %g\n", b.x, b.y, b.w, b.h);
+                out += buf;
+                break;
+            case Op::PopClip:
+                out += "unclip\n";
+                break;
+            case Op::Text: {
+                const TextRun& t = texts[c.index];
+                std::snprintf(buf, sizeof buf, "text %g %g %g %g #%08x %gpt w%d%s%s \"", b.x, b.y, b.w, b.h,
+                              color(c.color), t.font->sizePt, t.font->weight, t.font->italic ? " i" : "", t.fmt.wrap ? " wrap" : "");
+                out += buf;
+                for (wchar_t ch : t.text) {
+                    if (ch >= 0x20 && ch < 0x7F && ch != L'"' && ch != L'\\') {
+                        out += (char)ch;
+                    } else {
+                        std::snprintf(buf, sizeof buf, "\\u%04x", (unsigned)ch);
+                        out += buf;
+                    }
+                }
+                out += "\"\n";
+                break;
+            }
+            case Op::List:
+                lists[c.index]->serializeTo(out, dx + c.dx, dy + c.dy);
+                break;
+            }
+        }
+    }
+};
+
+// -------------------------------
+// RecordingRenderer: Renderer that appends to a DisplayList instead of drawing.
+// Its clip starts unbounded, so a recording holds the whole subtree and can be
+// replayed under any damage clip later.
+class RecordingRenderer : public Renderer {
+    std::shared_ptr<DisplayList> list = std::make_shared<DisplayList>();
+    std::vector<Rect> clips;
+    TextMeasurer& textMeasure;
+
+public:
+    explicit RecordingRenderer(TextMeasurer& m) : textMeasure(m) { setRetained(true); }
+
+    std::shared_ptr<const DisplayList> finish() {
+        std::shared_ptr<const DisplayList> out = std::move(list);
+        list = std::make_shared<DisplayList>();
+        clips.clear();
+        return out;
+    }
+
+    void fillRect(const Rect& r, Color c) override {
+        if (r.empty()) return;
+        push({DisplayList::Op::Fill, c, r, 0, 0, 0}, r);
+    }
+
+    void drawLine(double x0, double y0, double x1, double y1, Color c) override {
+        Rect b{ std::min(x0, x1), std::min(y0, y1), std::abs(x1 - x0) + 1, std::abs(y1 - y0) + 1 };
+        push({DisplayList::Op::Line, c, {x0, y0, x1, y1}, 0, 0, 0}, b);
+    }
+
+    void pushClip(const Rect& r) override {
+        clips.push_back(clips.empty() ? r : clips.back().intersected(r));
+        list->commands.push_back({DisplayList::Op::PushClip, {}, r, 0, 0, 0});
+    }
+
+    void popClip() override {
+        if (!clips.empty()) clips.pop_back();
+        list->commands.push_back({DisplayList::Op::PopClip, {}, {}, 0, 0, 0});
+    }
+
+    Rect clipBounds() const override {
+        return clips.empty() ? Renderer::clipBounds() : clips.back();
+    }
+
+    void drawText(const Rect& box, std::wstring_view text, const FontDesc& font, Color color, const TextFormat& fmt,
+                  const TextLayout* layout = nullptr) override {
+        if (text.empty()) return;
+        DisplayList::TextRun run{ std::wstring(text), internFont(font), fmt,
+                                  layout ? std::make_shared<const TextLayout>(*layout) : nullptr };
+        list->texts.push_back(std::move(run));
+        push({DisplayList::Op::Text, color, box, (uint32_t)list->texts.size() - 1, 0, 0}, box);
+    }
+
+    // clean child subtree: keep a reference instead of copying its commands
+    void drawList(const std::shared_ptr<const DisplayList>& child, double dx, double dy) override {
+        if (!child || child->empty()) return;
+        list->lists.push_back(child);
+        Rect b = child->bounds;
+        push({DisplayList::Op::List, {}, {}, (uint32_t)list->lists.size() - 1, (int)dx, (int)dy},
+             { b.x + (int)dx, b.y + (int)dy, b.w, b.h });
+    }
+
+    TextMeasurer& measurer() override { return textMeasure; }
+
+private:
+    void push(const DisplayList::Command& c, const Rect& drawn) {
+        list->commands.push_back(c);
+        Rect visible = clips.empty() ? drawn : drawn.intersected(clips.back());
+        list->bounds = list->bounds.united(visible);
+    }
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include "widgetManager.hpp"
+
+// -------------------------------
+// FrameScheduler: paces WidgetManager::tick against a target frame interval.
+// Invalidations between frames are coalesced into the next frame; with nothing
+// ticking, queued for layout or damaged, no frame is due at all and the host
+// loop can sleep until input arrives (e.g. MsgWaitForMultipleObjects with
+// waitMillis() as timeout).
+class FrameScheduler {
+public:
+    struct Stats {
+        uint64_t frames = 0;
+        uint64_t idleChecks = 0;   // poll() calls that found nothing to do
+    };
+
+    double targetInterval = 1.0 / 60.0;   // seconds
+
+private:
+    WidgetManager& manager;
+    double lastFrame = -std::numeric_limits<double>::infinity();
+    Stats counters;
+
+public:
+    explicit FrameScheduler(WidgetManager& m, double interval = 1.0 / 60.0)
+        : targetInterval(interval), manager(m) {}
+
+    // seconds until the next frame should run; infinity when idle
+    double timeUntilNextFrame(double now) {
+        if (manager.isIdle()) return std::numeric_limits<double>::infinity();
+        return std::max(0.0, lastFrame + targetInterval - now);
+    }
+
+    // timeout for a blocking wait; -1 = wait for input only
+    long waitMillis(double now) {
+        double t = timeUntilNextFrame(now);
+        if (t == std::numeric_limits<double>::infinity()) return -1;
+        return (long)std::ceil(t * 1000.0);
+    }
+
+    // runs a frame when one is due at `now` (seconds, any monotonic clock);
+    // returns true if it did
+    bool poll(double now) {
+        if (manager.isIdle()) {
+            ++counters.idleChecks;
+            return false;
+        }
+        if (now < lastFrame + targetInterval) return false;
+        // dt is capped so a long idle period doesn't jump animations ahead
+        double dt = std::min(now - lastFrame, 4 * targetInterval);
+        lastFrame = now;
+        ++counters.frames;
+        manager.tick(dt);
+        return true;
+    }
+
+    const Stats& stats() const { return counters; }
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include "layout.hpp"
+
+// -------------------------------
+// HitGrid: uniform grid over a container's children (child rects in the
+// container's content coordinates). Each cell lists the children overlapping
+// it in paint order, so a point query only looks at a handful of candidates.
+class HitGrid {
+    double x0 = 0, y0 = 0;
+    double cellW = 1, cellH = 1;
+    int cols = 0, rows = 0;
+    std::vector<uint32_t> cellStart;   // CSR offsets, size cols*rows+1
+    std::vector<uint32_t> items;       // child indices, ascending per cell
+    bool overlap = false;
+
+public:
+    // any two children intersect (hit order then depends on paint order)
+    bool childrenOverlap() const { return overlap; }
+
+    template <typename RectOf>
+    void build(size_t n, RectOf&& rectOf) {
+        overlap = false;
+        Rect bounds{0, 0, 0, 0};
+        for (size_t i = 0; i < n; ++i) bounds = bounds.united(rectOf(i));
+
+        int side = std::max(1, (int)std::ceil(std::sqrt((double)n)));
+        cols = rows = side;
+        x0 = std::floor(bounds.x);
+        y0 = std::floor(bounds.y);
+        cellW = std::max(1.0, (bounds.x + bounds.w - x0 + 1) / cols);
+        cellH = std::max(1.0, (bounds.y + bounds.h - y0 + 1) / rows);
+
+        // two passes: count, then fill
+        std::vector<uint32_t> counts((size_t)cols * rows + 1, 0);
+        forEachCell(n, rectOf, [&](size_t cell, size_t) { ++counts[cell + 1]; });
+        for (size_t c = 1; c < counts.size(); ++c) counts[c] += counts[c - 1];
+        cellStart = counts;
+        items.assign(cellStart.back(), 0);
+        forEachCell(n, rectOf, [&](size_t cell, size_t i) { items[counts[cell]++] = (uint32_t)i; });
+
+        // overlap check stays local to each cell; crowded cells are assumed to overlap
+        for (size_t c = 0; c + 1 < cellStart.size() && !overlap; ++c) {
+            uint32_t b = cellStart[c], e = cellStart[c + 1];
+            if (e - b > 32) { overlap = true; break; }
+            for (uint32_t i = b; i < e && !overlap; ++i)
+                for (uint32_t j = i + 1; j < e; ++j)
+                    if (rectOf(items[i]).intersects(rectOf(items[j]))) { overlap = true; break; }
+        }
+    }
+
+    // topmost child index containing (px, py) and accepted by pred, or -1
+    template <typename RectOf, typename Pred>
+    long query(int px, int py, RectOf&& rectOf, Pred&& accept) const {
+        if (cols == 0) return -1;
+        int cx = (int)std::floor((px - x0) / cellW);
+        int cy = (int)std::floor((py - y0) / cellH);
+        if (cx < 0 || cy < 0 || cx >= cols || cy >= rows) return -1;
+        size_t cell = (size_t)cy * cols + cx;
+        for (uint32_t k = cellStart[cell + 1]; k > cellStart[cell]; --k) {
+            uint32_t i = items[k - 1];
+            if (rectOf(i).contains(px, py) && accept(i)) return i;
+        }
+        return -1;
+    }
+
+private:
+    template <typename RectOf, typename Fn>
+    void forEachCell(size_t n, RectOf& rectOf, Fn&& fn) const {
+        for (size_t i = 0; i < n; ++i) {
+            Rect r = rectOf(i);
+            if (r.empty()) continue;
+            // same integer edges as Rect::contains
+            double l = (int)r.x, t = (int)r.y, rr = (int)(r.x + r.w), b = (int)(r.y + r.h);
+            int c0 = std::clamp((int)std::floor((l - x0) / cellW), 0, cols - 1);
+            int c1 = std::clamp((int)std::floor((rr - x0) / cellW), 0, cols - 1);
+            int r0 = std::clamp((int)std::floor((t - y0) / cellH), 0, rows - 1);
+            int r1 = std::clamp((int)std::floor((b - y0) / cellH), 0, rows - 1);
+            for (int cy = r0; cy <= r1; ++cy)
+                for (int cx = c0; cx <= c1; ++cx)
+                    fn((size_t)cy * cols + cx, i);
+        }
+    }
+};
@@ -3,6 +3,10 @@
 #include <memory>
 #include <algorithm>
 #include <limits>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include "arena.hpp"
 
 enum class Align { Start, Center, End, Stretch };
 enum class Orientation { Vertical, Horizontal };
@@ -16,12 +20,42 @@ struct LayoutConstraints {
     static LayoutConstraints Unbounded() {
         return LayoutConstraints{};
     }
+
+    bool operator==(const LayoutConstraints&) const = default;
 };
 struct Rect {
     double x, y, w, h;
     bool contains(int px, int py) const {
         return px >= (int)x && px < (int)(x + w) && py >= (int)y && py < (int)(y + h);
     }
+
+    bool empty() const { return w <= 0 || h <= 0; }
+
+    bool intersects(const Rect& o) const {
+        return x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+    }
+
+    bool containsRect(const Rect& o) const {
+        return o.x >= x && o.y >= y && o.x + o.w <= x + w && o.y + o.h <= y + h;
+    }
+
+    Rect intersected(const Rect& o) const {
+        double l = std::max(x, o.x), t = std::max(y, o.y);
+        double r = std::min(x + w, o.x + o.w), b = std::min(y + h, o.y + o.h);
+        return { l, t, std::max(0.0, r - l), std::max(0.0, b - t) };
+    }
+
+    Rect united(const Rect& o) const {
+        if (empty()) return o;
+        if (o.empty()) return *this;
+        double l = std::min(x, o.x), t = std::min(y, o.y);
+        double r = std::max(x + w, o.x + o.w), b = std::max(y + h, o.y + o.h);
+        return { l, t, r - l, b - t };
+    }
+
+    double area() const { return empty() ? 0 : w * h; }
+
+    bool operator==(const Rect&) const = default;
 };
 
 
@@ -33,7 +67,7 @@ struct Size {
 
 class Widget;
 
-class Layout {
+class Layout : public ArenaAllocated {
 public:
     virtual ~Layout() = default;
 
@@ -42,6 +76,14 @@ public:
 
     // arrange widget into given bounds (relative coordinates for widget->rect)
     virtual void arrange(Widget* widget, const Rect& bounds) = 0;
+
+    // copy for Widget::clone(): source owns this layout, copy is its clone with
+    // children already cloned (layouts holding child pointers remap them).
+    // Layouts that don't override it can't be copied: like a widget without
+    // cloneSelf(), cloning throws std::logic_error instead of dropping the layout.
+    virtual std::unique_ptr<Layout> clone(const Widget& /*source*/, Widget& /*copy*/) const {
+        throw std::logic_error(std::string("Layout::clone(): ") + typeid(*this).name() + " does not override clone()");
+    }
 };
 
 // -------------------------
@@ -0,0 +1,97 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include "widget.hpp"
+#include "taskPool.hpp"
+
+// -------------------------------
+// Parallel measure: layouts call measureChildren() before their (serial)
+// measure loop. When the children's subtrees are big enough, their measure()
+// calls run on the layout TaskPool and the loop then reads the cached sizes.
+// Only measure fans out: arrange is cheap once sizes are known and may change
+// the tree (VirtualScrollPanel creates rows there).
+//
+// measureOverride() of widgets measured this way may run on any thread: it
+// must only touch its own subtree and measure text via textMeasurer().
+struct ParallelLayoutOptions {
+    bool enabled = false;
+    size_t minTotalCost = 256;   // widgets to (re)measure before fanning out at all
+    size_t minTaskCost = 64;     // small siblings are batched up to this cost per task
+};
+
+inline ParallelLayoutOptions& parallelLayoutOptions() {
+    static ParallelLayoutOptions o;
+    return o;
+}
+
+inline std::unique_ptr<TaskPool>& layoutPoolSlot() {
+    static std::unique_ptr<TaskPool> pool;
+    return pool;
+}
+
+inline TaskPool& layoutPool() {
+    auto& p = layoutPoolSlot();
+    if (!p) p = std::make_unique<TaskPool>();
+    return *p;
+}
+
+// workers == 0: one per core but the calling thread
+inline void setParallelLayout(bool on, unsigned workers = 0) {
+    parallelLayoutOptions().enabled = on;
+    auto& p = layoutPoolSlot();
+    if (!on) return;
+    if (workers == 0) workers = TaskPool::defaultWorkers();
+    if (!p || p->workerCount() != workers) p = std::make_unique<TaskPool>(workers);
+}
+
+// expected work of child->measure(c): its subtree when not cached, else nothing
+inline size_t measureCost(const Widget* child, const LayoutConstraints& c) {
+    return child->hasCachedMeasure(c) ? 0 : child->getSubtreeSize();
+}
+
+// measures the children constraintOf(i) gives constraints for (std::optional,
+// nullopt = skip), in parallel when worthwhile; layouts whose children get
+// different constraints (GridLayout cells) use this directly
+template <typename ConstraintOf>
+inline void measureChildrenWith(Widget* widget, ConstraintOf&& constraintOf) {
+    const ParallelLayoutOptions& o = parallelLayoutOptions();
+    auto& kids = widget->children;
+    if (!o.enabled || kids.size() < 2 || widget->getSubtreeSize() < o.minTotalCost) return;
+
+    std::vector<LayoutConstraints> cs(kids.size());
+    std::vector<size_t> cost(kids.size(), 0);
+    size_t total = 0;
+    for (size_t i = 0; i < kids.size(); ++i) {
+        std::optional<LayoutConstraints> c = constraintOf(i);
+        if (!c) continue;
+        cs[i] = *c;
+        total += cost[i] = measureCost(kids[i].get(), *c);
+    }
+    if (total < o.minTotalCost) return;
+
+    // contiguous batches of about total / (4 * threads), never below minTaskCost
+    TaskPool& pool = layoutPool();
+    size_t target = std::max(o.minTaskCost, total / (4 * (pool.workerCount() + 1)));
+    TaskPool::Group group;
+    size_t begin = 0, acc = 0;
+    for (size_t i = 0; i < kids.size(); ++i) {
+        acc += cost[i];
+        if (acc < target && i + 1 < kids.size()) continue;
+        if (acc > 0) {
+            pool.submit(group, [&kids, &cs, &cost, begin, end = i + 1] {
+                PROF_SCOPE("measureTask", PHASE_OTHER);
+                for (size_t k = begin; k < end; ++k) if (cost[k]) kids[k]->measure(cs[k]);
+            });
+        }
+        begin = i + 1;
+        acc = 0;
+    }
+    pool.wait(group);
+}
+
+// measures every child of widget under c, in parallel when worthwhile
+inline void measureChildren(Widget* widget, const LayoutConstraints& c) {
+    measureChildrenWith(widget, [&c](size_t) { return std::optional<LayoutConstraints>(c); });
+}
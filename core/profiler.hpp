@@ -0,0 +1,205 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <deque>
+
+// -------------------------------
+// Profiler: per-frame counters + scoped phase timings, exported as Chrome
+// trace events (chrome://tracing, Perfetto). Instrumentation goes through the
+// PROF_* macros below, which expand to nothing unless WIDGET_PROFILE is
+// defined - same switch style as SET_DEBUG for LOG.
+
+struct FrameCounters {
+    uint64_t measureCalls = 0;
+    uint64_t measureCacheHits = 0;
+    uint64_t arrangeCalls = 0;
+    uint64_t arrangeSkips = 0;      // clean subtree, children not visited
+    uint64_t drawCalls = 0;         // Widget::draw actually ran
+    uint64_t listReplays = 0;       // retained display lists reused instead of draw
+    uint64_t textLayoutHits = 0;
+    uint64_t textLayoutMisses = 0;
+    uint64_t hitTestNodes = 0;      // widgets visited by hit testing
+    uint64_t relayoutBoundaries = 0;
+    uint64_t glyphHits = 0;         // glyph cache (software text)
+    uint64_t glyphMisses = 0;
+    double frameMs = 0;
+    double layoutMs = 0;
+    double paintMs = 0;
+    double eventMs = 0;
+};
+
+class Profiler {
+public:
+    enum Counter {
+        MEASURE_CALLS, MEASURE_CACHE_HITS, ARRANGE_CALLS, ARRANGE_SKIPS, DRAW_CALLS, LIST_REPLAYS,
+        TEXT_LAYOUT_HITS, TEXT_LAYOUT_MISSES, HIT_TEST_NODES, RELAYOUT_BOUNDARIES,
+        GLYPH_HITS, GLYPH_MISSES, COUNTER_COUNT
+    };
+    enum Phase { PHASE_LAYOUT, PHASE_PAINT, PHASE_EVENT, PHASE_OTHER };
+
+    struct TraceEvent {
+        const char* name;   // string literal
+        const char* cat;
+        int64_t ts;         // us since profiler start
+        int64_t dur;
+        uint32_t tid;
+    };
+
+    size_t historySize = 240;            // frames kept in history()
+    size_t maxTraceEvents = 1u << 20;    // oldest events dropped beyond this
+
+private:
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    Clock::time_point frameStart = start;
+
+    std::atomic<uint64_t> counters[COUNTER_COUNT] = {};
+    std::atomic<int64_t> phaseUs[PHASE_OTHER + 1] = {};
+
+    std::deque<FrameCounters> frames;
+    FrameCounters lastFrame;
+
+    std::mutex traceMtx;
+    std::deque<TraceEvent> events;
+    struct CounterSample { int64_t ts; FrameCounters c; };
+    std::deque<CounterSample> samples;
+    std::atomic<bool> tracing{true};   // toggled on the UI thread, read by workers
+
+public:
+    static Profiler& instance() {
+        static Profiler p;
+        return p;
+    }
+
+    void count(Counter c, uint64_t n = 1) { counters[c].fetch_add(n, std::memory_order_relaxed); }
+
+    int64_t nowUs() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    }
+
+    void setTracing(bool on) { tracing.store(on, std::memory_order_relaxed); }
+
+    void addEvent(const char* name, const char* cat, int64_t ts, int64_t dur, Phase phase) {
+        phaseUs[phase].fetch_add(dur, std::memory_order_relaxed);
+        if (!tracing.load(std::memory_order_relaxed)) return;
+        std::lock_guard<std::mutex> lock(traceMtx);
+        events.push_back({name, cat, ts, dur, threadId()});
+        if (events.size() > maxTraceEvents) events.pop_front();
+    }
+
+    // closes the current frame: counters move to history and the trace
+    void endFrame() {
+        FrameCounters f;
+        uint64_t* out[COUNTER_COUNT] = {
+            &f.measureCalls, &f.measureCacheHits, &f.arrangeCalls, &f.arrangeSkips, &f.drawCalls, &f.listReplays,
+            &f.textLayoutHits, &f.textLayoutMisses, &f.hitTestNodes, &f.relayoutBoundaries,
+            &f.glyphHits, &f.glyphMisses };
+        for (int i = 0; i < COUNTER_COUNT; ++i) *out[i] = counters[i].exchange(0, std::memory_order_relaxed);
+        f.layoutMs = phaseUs[PHASE_LAYOUT].exchange(0) / 1000.0;
+        f.paintMs = phaseUs[PHASE_PAINT].exchange(0) / 1000.0;
+        f.eventMs = phaseUs[PHASE_EVENT].exchange(0) / 1000.0;
+        phaseUs[PHASE_OTHER].store(0);
+        Clock::time_point now = Clock::now();
+        f.frameMs = std::chrono::duration<double, std::milli>(now - frameStart).count();
+        frameStart = now;
+
+        lastFrame = f;
+        frames.push_back(f);
+        while (frames.size() > historySize) frames.pop_front();
+        if (tracing.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(traceMtx);
+            samples.push_back({nowUs(), f});
+            while (samples.size() > maxTraceEvents / 16) samples.pop_front();
+        }
+    }
+
+    const FrameCounters& last() const { return lastFrame; }
+    const std::deque<FrameCounters>& history() const { return frames; }
+
+    void clearTrace() {
+        std::lock_guard<std::mutex> lock(traceMtx);
+        events.clear();
+        samples.clear();
+    }
+
+    // Chrome trace event format: complete events for phases, counter events per frame
+    bool writeChromeTrace(const char* path) {
+        FILE* f = std::fopen(path, "w");
+        if (!f) return false;
+        std::string json = chromeTrace();
+        bool ok = std::fwrite(json.data(), 1, json.size(), f) == json.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+    std::string chromeTrace() {
+        std::lock_guard<std::mutex> lock(traceMtx);
+        std::string out = "{\"traceEvents\":[\n";
+        char buf[512];
+        bool first = true;
+        for (const TraceEvent& e : events) {
+            std::snprintf(buf, sizeof buf, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}",
+                          first ? "" : ",\n", e.name, e.cat, (long long)e.ts, (long long)e.dur, e.tid);
+            out += buf;
+            first = false;
+        }
+        for (const CounterSample& s : samples) {
+            const FrameCounters& c = s.c;
+            std::snprintf(buf, sizeof buf,
+                          "%s{\"name\":\"frame\",\"ph\":\"C\",\"ts\":%lld,\"pid\":1,\"args\":{\"measure\":%llu,\"measureCacheHits\":%llu,"
+                          "\"arrange\":%llu,\"arrangeSkips\":%llu,\"draw\":%llu,\"listReplays\":%llu,\"textHits\":%llu,"
+                          "\"textMisses\":%llu,\"hitTestNodes\":%llu,\"relayoutBoundaries\":%llu,\"glyphHits\":%llu,\"glyphMisses\":%llu}}",
+                          first ? "" : ",\n", (long long)s.ts,
+                          (unsigned long long)c.measureCalls, (unsigned long long)c.measureCacheHits,
+                          (unsigned long long)c.arrangeCalls, (unsigned long long)c.arrangeSkips,
+                          (unsigned long long)c.drawCalls, (unsigned long long)c.listReplays,
+                          (unsigned long long)c.textLayoutHits, (unsigned long long)c.textLayoutMisses,
+                          (unsigned long long)c.hitTestNodes, (unsigned long long)c.relayoutBoundaries,
+                          (unsigned long long)c.glyphHits, (unsigned long long)c.glyphMisses);
+            out += buf;
+            first = false;
+        }
+        out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return out;
+    }
+
+private:
+    static uint32_t threadId() {
+        static std::atomic<uint32_t> next{1};
+        thread_local uint32_t id = next.fetch_add(1);
+        return id;
+    }
+};
+
+inline Profiler& profiler() { return Profiler::instance(); }
+
+// RAII timing of one scope into the trace
+class ProfileScope {
+    const char* name;
+    Profiler::Phase phase;
+    int64_t t0;
+public:
+    ProfileScope(const char* n, Profiler::Phase p) : name(n), phase(p), t0(profiler().nowUs()) {}
+    ~ProfileScope() { profiler().addEvent(name, "widget", t0, profiler().nowUs() - t0, phase); }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#ifdef WIDGET_PROFILE
+    #define PROF_CONCAT2(a, b) a##b
+    #define PROF_CONCAT(a, b) PROF_CONCAT2(a, b)
+    #define PROF_COUNT(counter) profiler().count(Profiler::counter)
+    #define PROF_COUNT_N(counter, n) profiler().count(Profiler::counter, (n))
+    #define PROF_SCOPE(name, phase) ProfileScope PROF_CONCAT(profScope_, __LINE__)(name, Profiler::phase)
+    #define PROF_END_FRAME() profiler().endFrame()
+#else
+    #define PROF_COUNT(counter) ((void)0)
+    #define PROF_COUNT_N(counter, n) ((void)0)
+    #define PROF_SCOPE(name, phase) ((void)0)
+    #define PROF_END_FRAME() ((void)0)
+#endif
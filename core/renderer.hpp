@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <memory>
+#include "layout.hpp"
+#include "text.hpp"
+
+// -------------------------------
+// Color: 8-bit RGBA, độc lập nền tảng (thay cho COLORREF)
+struct Color {
+    uint8_t r = 0, g = 0, b = 0, a = 255;
+
+    static constexpr Color rgb(uint8_t r, uint8_t g, uint8_t b) { return Color{r, g, b, 255}; }
+    static constexpr Color rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a) { return Color{r, g, b, a}; }
+
+    // memory order R,G,B,A -> 0xAABBGGRR on little-endian
+    constexpr uint32_t packed() const {
+        return (uint32_t)r | ((uint32_t)g << 8) | ((uint32_t)b << 16) | ((uint32_t)a << 24);
+    }
+
+    bool operator==(const Color&) const = default;
+};
+
+struct ColorHash {
+    size_t operator()(const Color& c) const { return std::hash<uint32_t>{}(c.packed()); }
+};
+
+struct TextFormat {
+    Align hAlign = Align::Start;
+    Align vAlign = Align::Start;   // only applies to single-line text
+    bool wrap = false;
+    bool ellipsize = false;        // only applies to single-line text
+};
+
+class DisplayList;
+
+// -------------------------------
+// Renderer: backend interface used by Widget::draw
+class Renderer {
+    bool retained = false;
+
+public:
+    virtual ~Renderer() = default;
+
+    virtual void beginFrame() {}
+    virtual void endFrame() {}
+
+    virtual void fillRect(const Rect& r, Color c) = 0;
+    virtual void drawLine(double x0, double y0, double x1, double y1, Color c) = 0;
+
+    // 1px outline inside r
+    virtual void strokeRect(const Rect& r, Color c) {
+        double x1 = r.x + r.w - 1, y1 = r.y + r.h - 1;
+        drawLine(r.x, r.y, x1, r.y, c);
+        drawLine(x1, r.y, x1, y1, c);
+        drawLine(x1, y1, r.x, y1, c);
+        drawLine(r.x, y1, r.x, r.y, c);
+    }
+
+    // clip stack: push intersects with the current clip
+    virtual void pushClip(const Rect& r) = 0;
+    virtual void popClip() = 0;
+
+    // current clip in window coordinates (used to cull widgets outside the damage)
+    virtual Rect clipBounds() const {
+        return { -1e9, -1e9, 2e9, 2e9 };
+    }
+
+    // layout: optional precomputed line breaks for text (e.g. from measure), reused when present
+    virtual void drawText(const Rect& box, std::wstring_view text, const FontDesc& font, Color color, const TextFormat& fmt,
+                          const TextLayout* layout = nullptr) = 0;
+
+    // measurer matching this backend's text rendering
+    virtual TextMeasurer& measurer() { return textMeasurer(); }
+
+    // retained mode: widgets paint through cached display lists (Widget::paint)
+    void setRetained(bool on) { retained = on; }
+    bool isRetained() const { return retained; }
+
+    // replays a recorded subtree at an offset; recorders keep a reference instead
+    virtual void drawList(const std::shared_ptr<const DisplayList>& list, double dx, double dy);
+};
+
+// DisplayList/RecordingRenderer need the complete Renderer
+#include "displayList.hpp"
+
+inline void Renderer::drawList(const std::shared_ptr<const DisplayList>& list, double dx, double dy) {
+    if (list) list->replay(*this, dx, dy);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+// -------------------------------
+// ResourceCache: interns backend resources (brushes, pens, fonts...) by key.
+// acquire()/release() keep a reference count; entries with no references are
+// kept for reuse and evicted least-recently-used first once size exceeds capacity.
+template <typename Key, typename Handle, typename Hash = std::hash<Key>>
+class ResourceCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+private:
+    struct Entry {
+        Handle handle;
+        int refs = 0;
+        uint64_t lastUse = 0;
+    };
+
+    std::unordered_map<Key, Entry, Hash> entries;
+    std::function<Handle(const Key&)> createFn;
+    std::function<void(Handle)> destroyFn;
+    size_t cap;
+    uint64_t clock = 0;
+    Stats counters;
+
+public:
+    ResourceCache(std::function<Handle(const Key&)> create, std::function<void(Handle)> destroy, size_t capacity = 256)
+        : createFn(std::move(create)), destroyFn(std::move(destroy)), cap(capacity) {}
+
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    ~ResourceCache() { clear(); }
+
+    Handle acquire(const Key& key) {
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            ++counters.hits;
+        } else {
+            ++counters.misses;
+            it = entries.emplace(key, Entry{createFn(key)}).first;
+        }
+        ++it->second.refs;
+        it->second.lastUse = ++clock;
+        if (entries.size() > cap) trim();
+        return it->second.handle;
+    }
+
+    void release(const Key& key) {
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.refs > 0) --it->second.refs;
+    }
+
+    // RAII acquire/release around a draw call; key must outlive the lease
+    class Lease {
+        ResourceCache* cache;
+        const Key* key;
+        Handle h;
+    public:
+        Lease(ResourceCache& c, const Key& k) : cache(&c), key(&k), h(c.acquire(k)) {}
+        ~Lease() { cache->release(*key); }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Handle get() const { return h; }
+        operator Handle() const { return h; }
+    };
+
+    Lease lease(const Key& key) { return Lease(*this, key); }
+
+    size_t size() const { return entries.size(); }
+    size_t capacity() const { return cap; }
+    void setCapacity(size_t c) { cap = c; trim(); }
+    const Stats& stats() const { return counters; }
+    void resetStats() { counters = {}; }
+
+    // destroys every entry; handles still referenced become invalid
+    void clear() {
+        for (auto& [k, e] : entries) destroyFn(e.handle);
+        entries.clear();
+    }
+
+private:
+    // evict unreferenced entries, oldest first, until size <= capacity
+    void trim() {
+        if (entries.size() <= cap) return;
+        std::vector<std::pair<uint64_t, const Key*>> idle;
+        for (auto& [k, e] : entries)
+            if (e.refs == 0) idle.push_back({e.lastUse, &k});
+        std::sort(idle.begin(), idle.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        std::vector<Key> victims;
+        for (size_t i = 0; i < idle.size() && entries.size() - victims.size() > cap; ++i)
+            victims.push_back(*idle[i].second);
+        for (const Key& k : victims) {
+            auto it = entries.find(k);
+            destroyFn(it->second.handle);
+            entries.erase(it);
+            ++counters.evictions;
+        }
+    }
+};
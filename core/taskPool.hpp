@@ -0,0 +1,160 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+// -------------------------------
+// TaskPool: small work-stealing pool. Every worker owns a deque: it pops its
+// own tasks newest-first and steals from the others oldest-first. Threads
+// outside the pool submit to a shared queue. wait() runs queued tasks while it
+// waits, so tasks may fan out and wait on nested groups without deadlocking.
+class TaskPool {
+public:
+    using Task = std::function<void()>;
+
+    // tasks submitted together; wait() returns once all of them ran
+    class Group {
+        friend TaskPool;
+        std::atomic<size_t> pending{0};
+        std::mutex errorMtx;
+        std::exception_ptr error;
+    };
+
+private:
+    struct Item {
+        Group* group;
+        Task fn;
+    };
+    struct Queue {
+        std::mutex m;
+        std::deque<Item> items;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;   // [0, workers) per worker, [workers] shared
+    std::vector<std::thread> threads;
+    std::mutex sleepMtx;
+    std::condition_variable wake;
+    std::atomic<size_t> queued{0};
+    bool stopping = false;
+
+    struct ThreadSlot {
+        const TaskPool* pool = nullptr;
+        size_t index = 0;
+    };
+    static ThreadSlot& slot() {
+        thread_local ThreadSlot s;
+        return s;
+    }
+
+public:
+    explicit TaskPool(unsigned workers = defaultWorkers()) {
+        for (unsigned i = 0; i <= workers; ++i) queues.push_back(std::make_unique<Queue>());
+        for (unsigned i = 0; i < workers; ++i) threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ~TaskPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : threads) t.join();
+    }
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    // all cores but the calling one
+    static unsigned defaultWorkers() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n > 1 ? n - 1 : 1;
+    }
+
+    unsigned workerCount() const { return (unsigned)threads.size(); }
+
+    void submit(Group& g, Task fn) {
+        g.pending.fetch_add(1, std::memory_order_relaxed);
+        Queue& q = *queues[ownQueue()];
+        {
+            std::lock_guard<std::mutex> lock(q.m);
+            q.items.push_back({ &g, std::move(fn) });
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        { std::lock_guard<std::mutex> lock(sleepMtx); }   // pairs with the sleeper's predicate check
+        wake.notify_one();
+    }
+
+    // helps with queued work until every task of g ran; rethrows the first task exception
+    void wait(Group& g) {
+        size_t self = ownQueue();
+        while (g.pending.load(std::memory_order_acquire) > 0) {
+            if (!runOne(self)) std::this_thread::yield();
+        }
+        if (g.error) {
+            std::exception_ptr e = g.error;
+            g.error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+private:
+    size_t ownQueue() const {
+        const ThreadSlot& s = slot();
+        return s.pool == this ? s.index : threads.size();
+    }
+
+    bool pop(size_t self, Item& out) {
+        // own queue: newest first (its data is still warm)
+        {
+            Queue& q = *queues[self];
+            std::lock_guard<std::mutex> lock(q.m);
+            if (!q.items.empty()) {
+                out = std::move(q.items.back());
+                q.items.pop_back();
+                return true;
+            }
+        }
+        // steal: oldest first (usually the biggest remaining piece)
+        for (size_t k = 1; k < queues.size(); ++k) {
+            Queue& q = *queues[(self + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(q.m);
+            if (!q.items.empty()) {
+                out = std::move(q.items.front());
+                q.items.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool runOne(size_t self) {
+        if (queued.load(std::memory_order_acquire) == 0) return false;
+        Item item;
+        if (!pop(self, item)) return false;
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        try {
+            item.fn();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(item.group->errorMtx);
+            if (!item.group->error) item.group->error = std::current_exception();
+        }
+        item.group->pending.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    void workerLoop(size_t index) {
+        slot() = { this, index };
+        for (;;) {
+            if (runOne(index)) continue;
+            std::unique_lock<std::mutex> lock(sleepMtx);
+            wake.wait(lock, [this] { return stopping || queued.load(std::memory_order_acquire) > 0; });
+            if (stopping && queued.load() == 0) return;
+        }
+    }
+};
@@ -0,0 +1,363 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <list>
+#include "layout.hpp"
+#include "profiler.hpp"
+
+// -------------------------------
+// Font description (backend resolves it to a real font)
+constexpr int FONT_WEIGHT_NORMAL = 400;
+constexpr int FONT_WEIGHT_BOLD = 700;
+
+struct FontDesc {
+    std::wstring name = L"Segoe UI";
+    double sizePt = 9.0;
+    int weight = FONT_WEIGHT_NORMAL;
+    bool italic = false;
+    bool underline = false;
+    bool strike = false;
+
+    // pixel height at 96 dpi
+    double pixelSize() const { return sizePt * 96.0 / 72.0; }
+
+    bool operator==(const FontDesc&) const = default;
+};
+
+struct FontDescHash {
+    size_t operator()(const FontDesc& f) const {
+        size_t h = std::hash<std::wstring>{}(f.name);
+        h ^= std::hash<double>{}(f.sizePt) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= (size_t)f.weight << 3 | (size_t)f.italic | (size_t)f.underline << 1 | (size_t)f.strike << 2;
+        return h;
+    }
+};
+
+// Interned, immutable font description: equal descriptions share one object,
+// so thousands of styles with the same font cost one allocation.
+using FontRef = std::shared_ptr<const FontDesc>;
+
+inline FontRef internFont(const FontDesc& desc) {
+    static std::mutex mtx;
+    static std::unordered_map<FontDesc, std::weak_ptr<const FontDesc>, FontDescHash> table;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& slot = table[desc];
+    if (FontRef f = slot.lock()) return f;
+    FontRef f = std::make_shared<const FontDesc>(desc);
+    slot = f;
+    // drop expired slots now and then so the table tracks live fonts only
+    if (table.size() > 64 && table.size() % 64 == 0) {
+        for (auto it = table.begin(); it != table.end();)
+            it = it->second.expired() ? table.erase(it) : std::next(it);
+    }
+    return f;
+}
+
+inline const FontRef& defaultFont() {
+    static const FontRef f = internFont(FontDesc{});
+    return f;
+}
+
+// -------------------------------
+// Text layout result: line breaks + extent
+struct TextLine {
+    size_t begin = 0;   // [begin, end) into the source text
+    size_t end = 0;
+    double width = 0;
+};
+
+struct TextLayout {
+    std::vector<TextLine> lines;   // may be empty if the backend only reports extents
+    Size extent;
+    double lineHeight = 0;
+};
+
+class TextMeasurer {
+public:
+    virtual ~TextMeasurer() = default;
+
+    // lay out text; when wrap is false maxWidth is ignored
+    virtual TextLayout layoutText(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) = 0;
+
+    // advance of a single character
+    virtual double charAdvance(const FontDesc& font, wchar_t ch) {
+        return layoutText(font, std::wstring_view(&ch, 1), 0, false).extent.w;
+    }
+
+    // may layoutText/charAdvance run on several threads at once (parallel layout)?
+    virtual bool threadSafe() const { return false; }
+
+    // shared result; caching measurers hand out the cached object
+    virtual std::shared_ptr<const TextLayout> layoutShared(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) {
+        return std::make_shared<const TextLayout>(layoutText(font, text, maxWidth, wrap));
+    }
+};
+
+// Greedy word wrap over per-character advances. Breaks on '\n' and after spaces,
+// falls back to a hard break inside words longer than maxWidth.
+template <typename AdvanceFn>
+TextLayout wrapText(std::wstring_view text, double maxWidth, bool wrap, double lineHeight, AdvanceFn&& advance) {
+    TextLayout out;
+    out.lineHeight = lineHeight;
+    if (!wrap || !(maxWidth > 0)) maxWidth = std::numeric_limits<double>::infinity();
+
+    constexpr size_t npos = std::wstring_view::npos;
+    size_t lineBegin = 0;
+    size_t lastBreak = npos;       // index just after the last space on this line
+    double width = 0;              // width of [lineBegin, i)
+    double widthToSpace = 0;       // width of [lineBegin, lastBreak - 1)
+    double widthToBreak = 0;       // width of [lineBegin, lastBreak)
+
+    auto emit = [&](size_t end, double w) {
+        out.lines.push_back({lineBegin, end, w});
+        out.extent.w = std::max(out.extent.w, w);
+    };
+
+    for (size_t i = 0; i < text.size(); ++i) {
+        wchar_t ch = text[i];
+        if (ch == L'\n') {
+            emit(i, width);
+            lineBegin = i + 1;
+            lastBreak = npos;
+            width = 0;
+            continue;
+        }
+        double a = advance(ch);
+        if (ch != L' ' && width + a > maxWidth && i > lineBegin) {
+            if (lastBreak != npos) {
+                emit(lastBreak - 1, widthToSpace);
+                lineBegin = lastBreak;
+                width -= widthToBreak;
+            } else {
+                emit(i, width);
+                lineBegin = i;
+                width = 0;
+            }
+            lastBreak = npos;
+        }
+        if (ch == L' ') {
+            widthToSpace = width;
+            widthToBreak = width + a;
+            lastBreak = i + 1;
+        }
+        width += a;
+    }
+    emit(text.size(), width);
+    out.extent.h = lineHeight * out.lines.size();
+    return out;
+}
+
+// Platform-neutral fallback measurer: fixed advance per character.
+// Good enough for headless layout and benchmarks; real backends install their own.
+class MonospaceTextMeasurer : public TextMeasurer {
+public:
+    double advanceRatio = 0.55;
+    double lineRatio = 1.25;
+
+    TextLayout layoutText(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) override {
+        double adv = charAdvance(font, L' ');
+        return wrapText(text, maxWidth, wrap, std::ceil(font.pixelSize() * lineRatio),
+                        [adv](wchar_t) { return adv; });
+    }
+
+    double charAdvance(const FontDesc& font, wchar_t) override {
+        double adv = font.pixelSize() * advanceRatio;
+        return font.weight >= FONT_WEIGHT_BOLD ? adv * 1.1 : adv;
+    }
+
+    bool threadSafe() const override { return true; }
+};
+
+// -------------------------------
+// TextLayoutCache: (font, text, width, wrap) -> line breaks + extent.
+// LRU, bounded by an approximate byte budget.
+class TextLayoutCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+private:
+    struct Key {
+        FontDesc font;
+        std::wstring text;
+        double width;
+        bool wrap;
+    };
+    // borrowed view used for lookups, so a hit doesn't allocate
+    struct KeyView {
+        const FontDesc* font;
+        std::wstring_view text;
+        double width;
+        bool wrap;
+    };
+    struct Node {
+        Key key;
+        std::shared_ptr<const TextLayout> layout;
+        size_t bytes;
+    };
+    using List = std::list<Node>;
+
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(const KeyView& k) const {
+            size_t h = std::hash<std::wstring_view>{}(k.text);
+            h ^= FontDescHash{}(*k.font) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<double>{}(k.width) + (k.wrap ? 1 : 0);
+            return h;
+        }
+        size_t operator()(const Key* k) const { return (*this)(view(*k)); }
+    };
+    struct KeyEq {
+        using is_transparent = void;
+        static bool eq(const KeyView& a, const KeyView& b) {
+            return a.width == b.width && a.wrap == b.wrap && a.text == b.text && *a.font == *b.font;
+        }
+        bool operator()(const Key* a, const Key* b) const { return eq(view(*a), view(*b)); }
+        bool operator()(const KeyView& a, const Key* b) const { return eq(a, view(*b)); }
+        bool operator()(const Key* a, const KeyView& b) const { return eq(view(*a), b); }
+    };
+    static KeyView view(const Key& k) { return { &k.font, k.text, k.width, k.wrap }; }
+
+    List lru;   // front = most recent
+    std::unordered_map<const Key*, List::iterator, KeyHash, KeyEq> index;
+    size_t used = 0;
+    Stats counters;
+
+public:
+    size_t byteBudget = 4u << 20;
+
+    std::shared_ptr<const TextLayout> get(TextMeasurer& m, const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) {
+        if (auto hit = find(font, text, maxWidth, wrap)) return hit;
+        if (!wrap) maxWidth = 0;
+        return insert(font, text, maxWidth, wrap, std::make_shared<const TextLayout>(m.layoutText(font, text, maxWidth, wrap)));
+    }
+
+    // lookup only; counts a hit or a miss
+    std::shared_ptr<const TextLayout> find(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) {
+        if (!wrap) maxWidth = 0;   // width doesn't affect single-line layout
+        auto it = index.find(KeyView{ &font, text, maxWidth, wrap });
+        if (it == index.end()) {
+            ++counters.misses;
+            return nullptr;
+        }
+        ++counters.hits;
+        lru.splice(lru.begin(), lru, it->second);
+        return it->second->layout;
+    }
+
+    // adds a layout computed outside the cache; keeps the existing one if another thread won
+    std::shared_ptr<const TextLayout> insert(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap,
+                                             std::shared_ptr<const TextLayout> layout) {
+        if (!wrap) maxWidth = 0;
+        auto it = index.find(KeyView{ &font, text, maxWidth, wrap });
+        if (it != index.end()) return it->second->layout;
+        size_t bytes = sizeof(Node) + 64
+                     + text.size() * sizeof(wchar_t)
+                     + font.name.size() * sizeof(wchar_t)
+                     + layout->lines.size() * sizeof(TextLine);
+        lru.push_front(Node{ Key{font, std::wstring(text), maxWidth, wrap}, layout, bytes });
+        index.emplace(&lru.front().key, lru.begin());
+        used += bytes;
+        while (used > byteBudget && lru.size() > 1) {
+            Node& victim = lru.back();
+            index.erase(&victim.key);
+            used -= victim.bytes;
+            lru.pop_back();
+            ++counters.evictions;
+        }
+        return layout;
+    }
+
+    void clear() {
+        index.clear();
+        lru.clear();
+        used = 0;
+    }
+
+    size_t size() const { return lru.size(); }
+    size_t bytesUsed() const { return used; }
+    const Stats& stats() const { return counters; }
+    void resetStats() { counters = {}; }
+};
+
+// Caching front for another measurer; results are shared between measure and draw.
+// Thread-safe: the cache is locked, and a source measurer that isn't
+// threadSafe() is called by one thread at a time (misses only).
+class CachingTextMeasurer : public TextMeasurer {
+    TextMeasurer* inner;
+    TextLayoutCache cache;
+    std::mutex cacheMtx;
+    std::mutex innerMtx;
+
+public:
+    explicit CachingTextMeasurer(TextMeasurer* m) : inner(m) {}
+
+    TextMeasurer* source() const { return inner; }
+    void setSource(TextMeasurer* m) {
+        std::lock_guard<std::mutex> lock(cacheMtx);
+        if (m == inner) return;
+        inner = m;
+        cache.clear();
+    }
+
+    TextLayoutCache& layoutCache() { return cache; }
+
+    TextLayout layoutText(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) override {
+        return *layoutShared(font, text, maxWidth, wrap);
+    }
+
+    std::shared_ptr<const TextLayout> layoutShared(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) override {
+        {
+            std::lock_guard<std::mutex> lock(cacheMtx);
+            if (auto hit = cache.find(font, text, maxWidth, wrap)) {
+                PROF_COUNT(TEXT_LAYOUT_HITS);
+                return hit;
+            }
+        }
+        PROF_COUNT(TEXT_LAYOUT_MISSES);
+        // lay out without holding the cache lock, so threads missing different texts overlap
+        std::shared_ptr<const TextLayout> layout;
+        if (inner->threadSafe()) {
+            layout = std::make_shared<const TextLayout>(inner->layoutText(font, text, maxWidth, wrap));
+        } else {
+            std::lock_guard<std::mutex> lock(innerMtx);
+            layout = std::make_shared<const TextLayout>(inner->layoutText(font, text, maxWidth, wrap));
+        }
+        std::lock_guard<std::mutex> lock(cacheMtx);
+        return cache.insert(font, text, maxWidth, wrap, std::move(layout));
+    }
+
+    double charAdvance(const FontDesc& font, wchar_t ch) override {
+        if (inner->threadSafe()) return inner->charAdvance(font, ch);
+        std::lock_guard<std::mutex> lock(innerMtx);
+        return inner->charAdvance(font, ch);
+    }
+
+    bool threadSafe() const override { return true; }
+};
+
+inline MonospaceTextMeasurer& fallbackTextMeasurer() {
+    static MonospaceTextMeasurer m;
+    return m;
+}
+
+inline CachingTextMeasurer& cachingTextMeasurer() {
+    static CachingTextMeasurer m(&fallbackTextMeasurer());
+    return m;
+}
+
+// measurer used by Widget::measure (Label...): cached front of the installed backend measurer
+inline TextMeasurer& textMeasurer() { return cachingTextMeasurer(); }
+inline void setTextMeasurer(TextMeasurer* m) {
+    if (m == &cachingTextMeasurer()) return;
+    cachingTextMeasurer().setSource(m ? m : &fallbackTextMeasurer());
+}
+inline TextLayoutCache& textLayoutCache() { return cachingTextMeasurer().layoutCache(); }
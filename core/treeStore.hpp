@@ -0,0 +1,99 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "layout.hpp"
+#include "profiler.hpp"
+
+class Widget;
+
+// -------------------------------
+// TreeStore: optional structure-of-arrays mirror of a widget tree. Nodes are
+// numbered in pre-order, so a subtree is the contiguous range [i, end[i]) and
+// whole-tree passes become linear scans over packed arrays instead of
+// recursion through children vectors. Widgets stay the owners; each widget
+// keeps its node index and writes its rect/flags through on change.
+class TreeStore {
+public:
+    // integer edges, same as Rect::contains
+    struct PackedRect {
+        int32_t x0, y0, x1, y1;
+        bool contains(int px, int py) const { return px >= x0 && px < x1 && py >= y0 && py < y1; }
+    };
+
+    enum : uint8_t {
+        NODE_VISIBLE = 1 << 0,
+        NODE_FOCUSABLE = 1 << 1,
+    };
+
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    // structure, rebuilt when children are added
+    std::vector<Widget*> node;
+    std::vector<uint32_t> parent;        // NONE for the root
+    std::vector<uint32_t> firstChild;    // NONE for leaves
+    std::vector<uint32_t> nextSibling;   // NONE for the last child
+    std::vector<uint32_t> end;           // one past the last descendant
+    std::vector<uint32_t> depth;
+
+    // hot per-node state, written through by the widgets
+    std::vector<PackedRect> rect;        // in the parent's content coordinates
+    std::vector<int32_t> offsetX, offsetY;   // childOffsetX/Y()
+    std::vector<uint8_t> flags;
+
+private:
+    bool stale = true;
+    mutable std::vector<int32_t> pointX, pointY;   // hitTest scratch
+
+public:
+    size_t size() const { return node.size(); }
+    bool isStale() const { return stale; }
+    void invalidate() { stale = true; }
+
+    // re-numbers the tree under root (defined after Widget)
+    void rebuild(Widget* root);
+    // copies rect/offset/flags of the widget at index i (defined after Widget)
+    void sync(uint32_t i, const Widget& w);
+    // forgets every widget it numbered; used when the tree is discarded or merged
+    void detach();
+
+    bool visible(uint32_t i) const { return flags[i] & NODE_VISIBLE; }
+    bool focusable(uint32_t i) const { return flags[i] & NODE_FOCUSABLE; }
+
+    // same result as Widget::hitTest: topmost visible node containing the
+    // point, descending only into nodes that contain it. (x, y) is in the
+    // coordinates of from's parent. Returns NONE when nothing was hit.
+    uint32_t hitTest(uint32_t from, int x, int y) const {
+        if (pointX.size() < node.size()) {
+            pointX.resize(node.size());
+            pointY.resize(node.size());
+        }
+        uint32_t hit = NONE;
+        // from itself is always searched (children may stick out of it)
+        pointX[from] = x - rect[from].x0 - offsetX[from];
+        pointY[from] = y - rect[from].y0 - offsetY[from];
+        if (rect[from].contains(x, y)) hit = from;
+
+        for (uint32_t i = from + 1; i < end[from];) {
+            int px = pointX[parent[i]], py = pointY[parent[i]];
+            if (!visible(i) || !rect[i].contains(px, py)) { i = end[i]; continue; }
+            // later in pre-order = painted above everything hit so far
+            hit = i;
+            pointX[i] = px - rect[i].x0 - offsetX[i];
+            pointY[i] = py - rect[i].y0 - offsetY[i];
+            ++i;
+            PROF_COUNT(HIT_TEST_NODES);
+        }
+        return hit;
+    }
+
+    // pre-order, same as Widget::collectFocusable
+    void collectFocusable(uint32_t from, std::vector<Widget*>& out) const {
+        for (uint32_t i = from; i < end[from]; ++i)
+            if (focusable(i)) out.push_back(node[i]);
+    }
+
+    template <typename Fn>
+    void forEach(uint32_t from, Fn&& fn) const {
+        for (uint32_t i = from; i < end[from]; ++i) fn(node[i]);
+    }
+};
@@ -1,9 +1,17 @@
 #pragma once
-#include <windows.h>
 #include <vector>
 #include <memory>
 #include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
 #include "layout.hpp"
+#include "renderer.hpp"
+#include "damage.hpp"
+#include "hitIndex.hpp"
+#include "treeStore.hpp"
+#include "profiler.hpp"
 
 #ifdef SET_DEBUG
     #include <iostream>
@@ -29,6 +37,17 @@
 
 
 class WidgetBuilder;
+class Widget;
+
+// per-tree bookkeeping, allocated on the root only
+struct WidgetTreeState {
+    std::vector<Widget*> relayoutQueue;   // relayout boundaries waiting for performLayout
+    DamageRegion damage;                  // window-space rects waiting for render
+    std::unique_ptr<TreeStore> store;     // flat mirror, only when enabled
+    std::vector<Widget*> tickers;         // widgets subscribed to frame ticks (may hold stale entries)
+    Widget* focusHead = nullptr;          // focus order (Tab): first/last focusable, visible widget
+    Widget* focusTail = nullptr;
+};
 
 
 class IEventWidget {
@@ -55,8 +74,9 @@ class IEventWidget {
 
 // -------------------------------
 // Widget base class
-class Widget : public IEventWidget {
+class Widget : public IEventWidget, public ArenaAllocated {
     friend WidgetBuilder;
+    friend TreeStore;
 protected:
     // config
     bool visible = true;
@@ -67,51 +87,270 @@ protected:
     bool hovered = false;
     bool focused = false;
 
+    // measure cache: keyed on constraints, dropped by markLayoutDirty()
+    struct MeasureCacheEntry {
+        LayoutConstraints c;
+        Size s;
+        bool valid = false;
+    };
+    mutable MeasureCacheEntry measureCache[2];
+    mutable unsigned char measureCacheNext = 0;
+
+    // incremental relayout
+    bool hasFixedSize = false;
+    Size fixedSize;
+    mutable bool measuredOnce = false;
+    mutable bool remeasured = true;             // measureOverride() ran since the last arrange
+    mutable LayoutConstraints lastConstraints;   // constraints of the latest measure() call
+    bool queuedForLayout = false;
+    std::unique_ptr<WidgetTreeState> treeState;   // only on the tree root
+
+    // hit-test acceleration, rebuilt lazily after children move
+    std::unique_ptr<HitGrid> hitIndex;
+    bool hitIndexDirty = true;
+    bool childOverlap = false;
+
+    // flat tree store (see enableTreeStore), set while this widget is numbered in it
+    TreeStore* store = nullptr;
+    uint32_t storeIndex = 0;
+
+    // what the children draw, relative to this widget's draw origin; it may reach
+    // outside rect (empty when the children are clipped to it)
+    Rect descendantBounds{};
+
+    // retained mode: this subtree's commands, recorded at window offset (listX, listY)
+    std::shared_ptr<const DisplayList> displayList;
+    int listX = 0, listY = 0;
+
+    size_t subtreeSize = 1;   // widgets in this subtree (cost estimate for parallel layout)
+
+    bool ticking = false;     // update(dt) is called every frame while set
+
+    // focus order: focusable widgets whose whole path is visible, linked in
+    // pre-order; kept up to date by addChild/setFocusable/setVisible
+    Widget* focusPrevW = nullptr;
+    Widget* focusNextW = nullptr;
+    bool inFocusOrder = false;
+    size_t focusCount = 0;    // widgets of this subtree in the focus order
+
 
 public:
     Rect rect;
     Widget* parent = nullptr;
     std::unique_ptr<Layout> layout;
     mutable Size meansureSize;
-    std::vector<std::unique_ptr<Widget>> children;
+    std::vector<std::unique_ptr<Widget>, ArenaAllocator<std::unique_ptr<Widget>>> children;   // in the arena with the widget
 
 
     Widget() = default;
     Widget(Widget&& other) = default;
     virtual ~Widget() = default;
 
+protected:
+    // prototype copy used by clone(): configuration and measure cache only - no
+    // parent, children, layout, tree state, focus links or subscriptions
+    Widget(const Widget& o) : IEventWidget(o), ArenaAllocated(o) {
+        visible = o.visible;
+        focusable = o.focusable;
+        hasFixedSize = o.hasFixedSize;
+        fixedSize = o.fixedSize;
+        // same content measures the same: the prototype's cache stays valid
+        measureCache[0] = o.measureCache[0];
+        measureCache[1] = o.measureCache[1];
+        measureCacheNext = o.measureCacheNext;
+        measuredOnce = o.measuredOnce;
+        lastConstraints = o.lastConstraints;
+        rect = o.rect;
+        meansureSize = o.meansureSize;
+        descendantBounds = o.descendantBounds;   // children are cloned at the same places
+    }
+    Widget& operator=(const Widget&) = delete;
+
+    // copy of this widget alone, keeping its dynamic type; every widget class
+    // meant to be cloned overrides it (return std::make_unique<T>(*this))
+    virtual std::unique_ptr<Widget> cloneSelf() const { return std::unique_ptr<Widget>(new Widget(*this)); }
 
-    void setVisible(bool v) { visible = v; }
-    void setFocusable(bool v) { focusable = v; }
+    // called on the copy once its children are cloned (remap pointers into the subtree)
+    virtual void onCloned(const Widget& /*proto*/) {}
+
+public:
+
+
+    void setVisible(bool v) {
+        if (visible == v) return;
+        visible = v;
+        if (!v) focusDetachSubtree();
+        else if (pathVisible()) focusAttachSubtree();
+        syncStore();
+        markDirty();
+    }
+    bool isVisible() const { return visible; }
+    void setFocusable(bool v) {
+        if (focusable == v) return;
+        focusable = v;
+        if (v && pathVisible()) {
+            inFocusOrder = true;
+            focusSplice(this, this, 1);
+        } else if (!v && inFocusOrder) {
+            focusUnlink(this, this, 1);
+            inFocusOrder = false;
+        }
+        syncStore();
+    }
     bool isFocusable() const { return focusable; }
     bool hasFocus() const { return focused; }
 
     // --- Drawing & Updating ---
-    virtual void draw(HDC hdc, int ox=0, int oy=0) {
+    virtual void draw(Renderer& r, int ox=0, int oy=0) {
 #ifdef SET_DEBUG
         // debug: draw border only (no fill), 1px, inside widget rect
-        HPEN hPen = CreatePen(PS_SOLID, 1, RGB(255, 0, 0));
-        HGDIOBJ hOldPen = SelectObject(hdc, hPen);
-        HGDIOBJ hOldBrush = SelectObject(hdc, GetStockObject(NULL_BRUSH)); // no fill
+        r.strokeRect({ox + (double)(int)rect.x, oy + (double)(int)rect.y, (double)(int)rect.w, (double)(int)rect.h},
+                     Color::rgb(255, 0, 0));
+#endif
+        drawChildren(r, ox + (int)rect.x + childOffsetX(), oy + (int)rect.y + childOffsetY());
+    }
 
-        // shrink rect by 1px inward so border is inside bounds
-        int left   = ox + (int)rect.x;
-        int top    = oy + (int)rect.y;
-        int right  = left + (int)rect.w - 1;
-        int bottom = top + (int)rect.h - 1;
+    // draws visible children whose subtree intersects the renderer's clip (damage) area;
+    // (cx, cy) is the window position of this widget's content origin
+    void drawChildren(Renderer& r, int cx, int cy) {
+        Rect clip = r.clipBounds();
+        for (auto &c : children) {
+            if (!c->visible) continue;
+            Rect wr = c->drawBounds();
+            wr.x += cx;
+            wr.y += cy;
+            if (!wr.intersects(clip)) continue;
+            c->paint(r, cx, cy);
+            c->dirty = false;
+        }
+    }
 
-        Rectangle(hdc, left, top, right, bottom);
+    // draw() or, for a retained renderer, the subtree's display list: a clean
+    // subtree is replayed (or referenced by the parent's recording) without
+    // calling draw(); a dirty one is recorded again first
+    void paint(Renderer& r, int ox = 0, int oy = 0) {
+        if (!r.isRetained()) { PROF_COUNT(DRAW_CALLS); draw(r, ox, oy); return; }
+        if (dirty || !displayList) {
+            RecordingRenderer rec(r.measurer());
+            PROF_COUNT(DRAW_CALLS);
+            draw(rec, ox, oy);
+            displayList = rec.finish();
+            listX = ox;
+            listY = oy;
+            dirty = false;
+        } else {
+            PROF_COUNT(LIST_REPLAYS);
+        }
+        r.drawList(displayList, ox - listX, oy - listY);
+    }
 
-        SelectObject(hdc, hOldPen);
-        SelectObject(hdc, hOldBrush);
-        DeleteObject(hPen);
-#endif
-        for (auto &c : children) c->draw(hdc, ox + (int)rect.x, oy + (int)rect.y);
+    const std::shared_ptr<const DisplayList>& getDisplayList() const { return displayList; }
+
+    // forget recorded lists (e.g. after painting without retained mode)
+    void dropDisplayLists() {
+        displayList.reset();
+        for (auto& c : children) c->dropDisplayLists();
+    }
+
+    // offset applied to children when drawing (scrolling containers)
+    virtual int childOffsetX() const { return 0; }
+    virtual int childOffsetY() const { return 0; }
+
+    // rect in window coordinates, matching what draw() uses
+    Rect windowRect() const {
+        int x = (int)rect.x, y = (int)rect.y;
+        for (const Widget* p = parent; p; p = p->parent) {
+            x += (int)p->rect.x + p->childOffsetX();
+            y += (int)p->rect.y + p->childOffsetY();
+        }
+        return { (double)x, (double)y, rect.w, rect.h };
+    }
+
+    // children are drawn inside rect only (scrolling containers): they never
+    // overflow it, whatever their own rects say
+    virtual bool clipsChildren() const { return false; }
+
+    // rect plus what the descendants draw, in the parent's content coordinates
+    // with the same integer origin draw() uses
+    Rect drawBounds() const {
+        Rect own = { (double)(int)rect.x, (double)(int)rect.y, rect.w, rect.h };
+        Rect d = descendantBounds;
+        d.x += own.x;
+        d.y += own.y;
+        return own.united(d);
+    }
+
+    // drawBounds() in window coordinates: what repainting this subtree touches
+    Rect windowDrawBounds() const {
+        Rect wr = windowRect();
+        Rect d = descendantBounds;
+        d.x += wr.x;
+        d.y += wr.y;
+        return wr.united(d);
+    }
+
+    // recomputes descendantBounds from the children (after they are arranged)
+    void updateDescendantBounds() {
+        Rect b{};
+        if (!clipsChildren()) {
+            for (auto& c : children) {
+                Rect cb = c->drawBounds();
+                cb.x += childOffsetX();
+                cb.y += childOffsetY();
+                b = b.united(cb);
+            }
+        }
+        descendantBounds = b;
+    }
+
+    // a subtree was laid out on its own: widen the ancestors' bounds to cover it
+    // (they only shrink again when the ancestor is arranged)
+    void growAncestorBounds() {
+        for (Widget* w = this; w->parent && !w->parent->clipsChildren(); w = w->parent) {
+            Widget* p = w->parent;
+            Rect cb = w->drawBounds();
+            cb.x += p->childOffsetX();
+            cb.y += p->childOffsetY();
+            Rect u = p->descendantBounds.united(cb);
+            if (u == p->descendantBounds) break;
+            p->descendantBounds = u;
+        }
+    }
+
+    Widget* treeRoot() {
+        Widget* w = this;
+        while (w->parent) w = w->parent;
+        return w;
+    }
+
+    WidgetTreeState& tree() {
+        Widget* root = treeRoot();
+        if (!root->treeState) root->treeState = std::make_unique<WidgetTreeState>();
+        return *root->treeState;
+    }
+
+    // state of a tree a WidgetManager has laid out; nullptr while the tree is
+    // still being built (its first layout and paint cover everything)
+    WidgetTreeState* existingTree() { return treeRoot()->treeState.get(); }
+
+    // queue a window-space rect for repaint
+    void addDamage(const Rect& windowArea) {
+        if (WidgetTreeState* t = existingTree()) t->damage.add(windowArea);
     }
 
-    virtual void update(double dt) {
-        for (auto &c : children) c->update(dt);
+    // called once per frame while subscribed with startTicking(); not recursive -
+    // idle widgets cost nothing per frame
+    virtual void update(double /*dt*/) {}
+
+    // subscribe to frame ticks (animations, polling); the frame scheduler stays
+    // awake while any widget ticks
+    void startTicking() {
+        if (ticking) return;
+        ticking = true;
+        tree().tickers.push_back(this);
     }
+    void stopTicking() { ticking = false; }   // list entry is dropped on the next frame
+    bool isTicking() const { return ticking; }
 
     // virtual overrides for events
     void onMouseEnter() { hovered = true; markDirty(); }
@@ -122,56 +361,402 @@ public:
     Size GetSize() {
         return {rect.w, rect.h};
     }
-    virtual Size measure(const LayoutConstraints& c) const;
+    // cached: only calls measureOverride() when constraints are new or layout is dirty
+    Size measure(const LayoutConstraints& c) const;
+    virtual Size measureOverride(const LayoutConstraints& c) const;
     virtual void arrange(const Rect& bounds);
+    // places children once arrange() decided this subtree needs it (rect is already bounds)
+    virtual void arrangeChildren(const Rect& bounds);
+
+    // size no longer depends on children -> acts as a relayout boundary
+    void setFixedSize(double w, double h) {
+        if (hasFixedSize && fixedSize.w == w && fixedSize.h == h) return;
+        hasFixedSize = true;
+        fixedSize = {w, h};
+        rect.w = w;
+        rect.h = h;
+        syncStore();
+        // this widget is a boundary now, but its new size moves the siblings:
+        // invalidation starts at the parent
+        layoutDirty = true;
+        invalidateMeasureCache();
+        if (parent) parent->markLayoutDirty();
+        else markLayoutDirty();
+    }
+    void clearFixedSize() {
+        if (!hasFixedSize) return;
+        hasFixedSize = false;
+        markLayoutDirty();
+    }
+
+    // A relayout boundary's size can't change because of its children (fixed size,
+    // or tight constraints from its parent), so relayout of its subtree stops here.
+    virtual bool isRelayoutBoundary() const {
+        if (!parent) return true;
+        if (!measuredOnce) return false;
+        if (hasFixedSize) return true;
+        return lastConstraints.minW == lastConstraints.maxW && lastConstraints.minH == lastConstraints.maxH;
+    }
 
     // --- Utility ---
     void addChild(std::unique_ptr<Widget> w) {
+        // pending relayouts/damage of a detached subtree are covered by its new parent
+        std::vector<Widget*> tickers;
+        if (w->treeState) {
+            for (Widget* q : w->treeState->relayoutQueue) q->queuedForLayout = false;
+            if (w->treeState->store) w->treeState->store->detach();
+            tickers = std::move(w->treeState->tickers);
+            w->treeState.reset();
+        }
+        // the child's focus chain is already in pre-order: splice it in as one block
+        if (w->focusCount > 0 && !pathVisible()) w->focusDetachSubtree();
         w->parent = this;
+        if (!tickers.empty()) {
+            auto& mine = tree().tickers;
+            for (Widget* t : tickers) if (t->ticking) mine.push_back(t);
+        }
+        for (Widget* p = this; p; p = p->parent) p->subtreeSize += w->subtreeSize;
+        Widget* child = w.get();
         children.push_back(std::move(w));
+        if (child->focusCount > 0) {
+            size_t n = child->focusCount;
+            child->focusCount = 0;   // focusSplice adds n back along the whole path
+            child->focusSplice(firstFocusIn(child), lastFocusIn(child), n);
+        }
+        hitIndexDirty = true;
+        if (WidgetTreeState* t = existingTree(); t && t->store) t->store->invalidate();
+        markLayoutDirty();
         markDirty();
     }
 
+    // needs repaint: flags the path to the root and damages what this subtree draws
     virtual void markDirty() {
-        dirty = true;
-        if (parent) parent->markDirty();
+        for (Widget* w = this; w; w = w->parent) w->dirty = true;
+        addDamage(windowDrawBounds());
     }
 
     bool isDirty() const { return dirty; }
-    void clearDirty() { dirty = false; for (auto &c : children) c->clearDirty(); }
+    void clearDirtyFlag() { dirty = false; }
+    void clearDirty() {
+        if (TreeStore* s = flatStore()) { s->forEach(storeIndex, [](Widget* w) { w->dirty = false; }); return; }
+        forEachInSubtree([](Widget* w) { w->dirty = false; });
+    }
 
+    // marks the path up to the nearest relayout boundary and queues that boundary on the root
     void markLayoutDirty() {
-        layoutDirty = true;
-        if (parent) parent->markLayoutDirty();
+        Widget* w = this;
+        for (;;) {
+            w->layoutDirty = true;
+            w->invalidateMeasureCache();
+            if (w->isRelayoutBoundary()) break;
+            w = w->parent;
+        }
+        if (w->queuedForLayout) return;
+        WidgetTreeState* t = w->existingTree();
+        if (!t) return;   // tree under construction: the flags are enough
+        w->queuedForLayout = true;
+        t->relayoutQueue.push_back(w);
+    }
+
+    const LayoutConstraints& getLastConstraints() const { return lastConstraints; }
+
+    // measure(c) would be answered from the cache
+    bool hasCachedMeasure(const LayoutConstraints& c) const {
+        for (const auto& e : measureCache)
+            if (e.valid && e.c == c) return true;
+        return false;
+    }
+
+    size_t getSubtreeSize() const { return subtreeSize; }
+
+    // boundaries queued by markLayoutDirty(); caller lays them out
+    std::vector<Widget*> takeRelayoutQueue() {
+        std::vector<Widget*> q = std::move(tree().relayoutQueue);
+        tree().relayoutQueue.clear();
+        for (Widget* w : q) w->queuedForLayout = false;
+        return q;
+    }
+
+    // frame work waiting on this tree: relayout, repaint or ticking widgets
+    bool hasPendingFrameWork() {
+        WidgetTreeState& t = tree();
+        return !t.relayoutQueue.empty() || !t.damage.empty() || !t.tickers.empty();
+    }
+
+    // widgets subscribed with startTicking(), stale entries removed
+    std::vector<Widget*> takeTickers() {
+        auto& list = tree().tickers;
+        list.erase(std::remove_if(list.begin(), list.end(), [](Widget* w) { return !w->ticking; }), list.end());
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+        return list;
+    }
+
+    // damage queued by markDirty(); caller repaints it
+    DamageRegion takeDamage() {
+        DamageRegion d = std::move(tree().damage);
+        tree().damage.clear();
+        return d;
+    }
+    void invalidateMeasureCache() const {
+        for (auto& e : measureCache) e.valid = false;
     }
     bool isLayoutDirty() const { return layoutDirty; }
-    void clearLayoutDirty() { layoutDirty = false; for (auto &c : children) c->clearLayoutDirty(); }
+    void clearLayoutDirty() {
+        if (TreeStore* s = flatStore()) { s->forEach(storeIndex, [](Widget* w) { w->layoutDirty = false; }); return; }
+        forEachInSubtree([](Widget* w) { w->layoutDirty = false; });
+    }
 
-    // hit test
-    Widget* hitTest(int x, int y) {
-        int rx = x - (int)rect.x;
-        int ry = y - (int)rect.y;
+    // containers with at least this many children get a HitGrid
+    static constexpr size_t HIT_INDEX_MIN_CHILDREN = 16;
+
+    // call after moving children without arrange() (direct rect writes)
+    void invalidateHitIndex() {
+        hitIndexDirty = true;
+        for (auto& c : children) c->syncStore();
+    }
+
+    void ensureHitIndex() {
+        if (!hitIndexDirty) return;
+        hitIndexDirty = false;
+        auto rectOf = [this](size_t i) { return children[i]->rect; };
+        if (children.size() >= HIT_INDEX_MIN_CHILDREN) {
+            if (!hitIndex) hitIndex = std::make_unique<HitGrid>();
+            hitIndex->build(children.size(), rectOf);
+            childOverlap = hitIndex->childrenOverlap();
+        } else {
+            hitIndex.reset();
+            childOverlap = false;
+            for (size_t i = 0; i < children.size() && !childOverlap; ++i)
+                for (size_t j = i + 1; j < children.size(); ++j)
+                    if (rectOf(i).intersects(rectOf(j))) { childOverlap = true; break; }
+        }
+    }
+
+    // children may cover each other -> hit result depends on paint order
+    bool childrenMayOverlap() {
+        ensureHitIndex();
+        return childOverlap;
+    }
+
+    // topmost visible child containing (cx, cy), in this widget's content coordinates
+    Widget* childAt(int cx, int cy) {
+        ensureHitIndex();
+        if (hitIndex) {
+            long i = hitIndex->query(cx, cy, [this](size_t k) { return children[k]->rect; },
+                                     [this](size_t k) { return children[k]->visible; });
+            return i < 0 ? nullptr : children[i].get();
+        }
         for (auto it = children.rbegin(); it != children.rend(); ++it) {
             Widget* child = it->get();
-            if (child->rect.contains(rx, ry)) {
-                Widget* hit = child->hitTest(rx, ry);
-                return hit ? hit : child;
-            }
+            if (child->visible && child->rect.contains(cx, cy)) return child;
+        }
+        return nullptr;
+    }
+
+    // hit test; (x, y) in the parent's content coordinates
+    Widget* hitTest(int x, int y) {
+        PROF_COUNT(HIT_TEST_NODES);
+        int rx = x - (int)rect.x - childOffsetX();
+        int ry = y - (int)rect.y - childOffsetY();
+        if (Widget* child = childAt(rx, ry)) {
+            Widget* hit = child->hitTest(rx, ry);
+            return hit ? hit : child;
         }
         if (rect.contains(x, y)) return this;
         return nullptr;
     }
 
+    // --- Focus order ---
+    // next/previous widget in Tab order, nullptr at the ends; O(1)
+    Widget* nextInFocusOrder() const { return focusNextW; }
+    Widget* prevInFocusOrder() const { return focusPrevW; }
+    bool isInFocusOrder() const { return inFocusOrder; }
+    Widget* firstInFocusOrder() { return focusCount ? firstFocusIn(this) : nullptr; }
+    Widget* lastInFocusOrder() { return focusCount ? lastFocusIn(this) : nullptr; }
+    size_t focusOrderSize() const { return focusCount; }
+
     // find all focusable descendants
     void collectFocusable(std::vector<Widget*>& out) {
-        if (focusable) out.push_back(this);
-        for (auto& c : children) c->collectFocusable(out);
+        if (TreeStore* s = flatStore()) { s->collectFocusable(storeIndex, out); return; }
+        forEachInSubtree([&out](Widget* w) { if (w->focusable) out.push_back(w); });
+    }
+
+    // pre-order walk without the store (the store lookup is per call, not per node)
+    template <typename Fn>
+    void forEachInSubtree(Fn&& fn) {
+        fn(this);
+        for (auto& c : children) c->forEachInSubtree(fn);
+    }
+
+    // --- Prototypes ---
+    // deep copy of this subtree: widget types, layouts and ticking are kept,
+    // copy-on-write parts (label text, styles) are shared with the prototype.
+    // Throws std::logic_error if a widget class in the subtree lacks cloneSelf()
+    // or one of its layouts lacks Layout::clone().
+    std::unique_ptr<Widget> clone() const;
+
+    // child of this copy standing where protoChild stands in proto (see onCloned)
+    Widget* correspondingChild(const Widget& proto, const Widget* protoChild) const {
+        for (size_t i = 0; i < proto.children.size() && i < children.size(); ++i)
+            if (proto.children[i].get() == protoChild) return children[i].get();
+        return nullptr;
+    }
+
+    // --- Flat tree store ---
+    // Mirrors the tree into a TreeStore kept on the root; whole-tree passes
+    // (clearDirty, clearLayoutDirty, collectFocusable, WidgetManager::hitTest)
+    // then scan arrays instead of recursing. Call on the root.
+    void enableTreeStore(bool on = true) {
+        WidgetTreeState& t = tree();
+        if (on && !t.store) t.store = std::make_unique<TreeStore>();
+        if (!on && t.store) { t.store->detach(); t.store.reset(); }
+    }
+
+    // up-to-date store containing this widget, or nullptr when not enabled
+    TreeStore* flatStore() {
+        WidgetTreeState* t = existingTree();
+        TreeStore* s = t ? t->store.get() : nullptr;
+        if (!s) return nullptr;
+        if (s->isStale()) s->rebuild(treeRoot());
+        return s;
+    }
+
+    uint32_t flatIndex() const { return storeIndex; }
+
+    // write rect/flags/scroll offset through to the store; rect is written
+    // directly in a few places, those call this (or invalidateHitIndex on the parent)
+    void syncStore() {
+        if (store && !store->isStale()) store->sync(storeIndex, *this);
+    }
+
+private:
+    std::unique_ptr<Widget> cloneTree(Widget* parentCopy, std::vector<Widget*>& tickers) const;
+
+    // --- focus order maintenance ---
+    bool pathVisible() const {
+        for (const Widget* w = this; w; w = w->parent) if (!w->visible) return false;
+        return true;
+    }
+
+    static Widget* firstFocusIn(Widget* w) {
+        while (!w->inFocusOrder) {
+            auto it = std::find_if(w->children.begin(), w->children.end(), [](auto& c) { return c->focusCount > 0; });
+            w = it->get();
+        }
+        return w;
+    }
+
+    static Widget* lastFocusIn(Widget* w) {
+        for (;;) {
+            auto it = std::find_if(w->children.rbegin(), w->children.rend(), [](auto& c) { return c->focusCount > 0; });
+            if (it == w->children.rend()) return w;
+            w = it->get();
+        }
+    }
+
+    // last widget in the order before this one, ignoring this subtree
+    Widget* focusPredecessor() {
+        for (Widget* cur = this; cur->parent; cur = cur->parent) {
+            Widget* p = cur->parent;
+            if (p->focusCount != cur->focusCount) {   // something besides cur's subtree is in p
+                auto& sib = p->children;
+                auto it = std::find_if(sib.rbegin(), sib.rend(), [cur](auto& c) { return c.get() == cur; });
+                for (++it; it != sib.rend(); ++it)
+                    if ((*it)->focusCount) return lastFocusIn(it->get());
+            }
+            if (p->inFocusOrder) return p;
+        }
+        return nullptr;
+    }
+
+    // links the chain first..last (n widgets of this subtree, not yet counted) into place
+    void focusSplice(Widget* first, Widget* last, size_t n) {
+        WidgetTreeState& t = tree();
+        Widget* pred = focusPredecessor();
+        Widget* succ = pred ? pred->focusNextW : t.focusHead;
+        first->focusPrevW = pred;
+        last->focusNextW = succ;
+        (pred ? pred->focusNextW : t.focusHead) = first;
+        (succ ? succ->focusPrevW : t.focusTail) = last;
+        for (Widget* p = this; p; p = p->parent) p->focusCount += n;
+    }
+
+    // cuts the chain first..last out of the order; its inner links stay
+    void focusUnlink(Widget* first, Widget* last, size_t n) {
+        WidgetTreeState& t = tree();
+        (first->focusPrevW ? first->focusPrevW->focusNextW : t.focusHead) = last->focusNextW;
+        (last->focusNextW ? last->focusNextW->focusPrevW : t.focusTail) = first->focusPrevW;
+        first->focusPrevW = last->focusNextW = nullptr;
+        for (Widget* p = this; p; p = p->parent) p->focusCount -= n;
+    }
+
+    void focusDetachSubtree() {
+        if (!focusCount) return;
+        Widget* first = firstFocusIn(this);
+        focusUnlink(first, lastFocusIn(this), focusCount);
+        for (Widget* w = first; w; ) {
+            Widget* next = w->focusNextW;
+            w->inFocusOrder = false;
+            w->focusPrevW = w->focusNextW = nullptr;
+            w = next;
+        }
+        for (auto& c : children) if (c->focusCount) clearFocusCounts(c.get());
+    }
+
+    static void clearFocusCounts(Widget* w) {
+        w->focusCount = 0;
+        for (auto& c : w->children) if (c->focusCount) clearFocusCounts(c.get());
+    }
+
+    // this subtree just became visible: link its focusable widgets in pre-order, then splice once
+    void focusAttachSubtree() {
+        Widget* first = nullptr;
+        Widget* last = nullptr;
+        size_t n = linkFocusChain(this, first, last);
+        if (!n) return;
+        focusCount = 0;
+        focusSplice(first, last, n);
+    }
+
+    static size_t linkFocusChain(Widget* w, Widget*& first, Widget*& last) {
+        if (!w->visible) return 0;
+        size_t n = 0;
+        if (w->focusable) {
+            w->inFocusOrder = true;
+            w->focusPrevW = last;
+            w->focusNextW = nullptr;
+            (last ? last->focusNextW : first) = w;
+            last = w;
+            n = 1;
+        }
+        for (auto& c : w->children) n += linkFocusChain(c.get(), first, last);
+        w->focusCount = n;
+        return n;
     }
-    Widget clone();
 };
 
 
-Size Widget::measure(const LayoutConstraints& c) const{
+inline Size Widget::measure(const LayoutConstraints& c) const {
+    PROF_COUNT(MEASURE_CALLS);
+    for (const auto& e : measureCache) {
+        if (e.valid && e.c == c) {
+            PROF_COUNT(MEASURE_CACHE_HITS);
+            lastConstraints = c;
+            return meansureSize = e.s;
+        }
+    }
+    lastConstraints = c;
+    measuredOnce = true;
+    remeasured = true;
+    Size s = measureOverride(c);
+    if (hasFixedSize) s = { clampDouble(fixedSize.w, c.minW, c.maxW), clampDouble(fixedSize.h, c.minH, c.maxH) };
+    measureCache[measureCacheNext] = {c, s, true};
+    measureCacheNext ^= 1;
+    return meansureSize = s;
+}
+
+inline Size Widget::measureOverride(const LayoutConstraints& c) const{
     if (layout) {
         return meansureSize = layout->measure(const_cast<Widget*>(this), c);
     } else if (!children.empty()) {
@@ -191,10 +776,25 @@ Size Widget::measure(const LayoutConstraints& c) const{
     return meansureSize;
 }
 
-void Widget::arrange(const Rect& bounds){
+inline void Widget::arrange(const Rect& bounds){
+    // clean subtree at the same place: children are already arranged
+    PROF_COUNT(ARRANGE_CALLS);
+    if (!layoutDirty && !remeasured && bounds == rect) { PROF_COUNT(ARRANGE_SKIPS); return; }
     LOG ("Widget arrange in bounds x:" << bounds.x << " y:" << bounds.y << " w:" << bounds.w << " h:" << bounds.h);
+    // a relayout boundary below a cache hit was never re-measured this pass:
+    // its children's sizes are stale until it is
+    if (layoutDirty && measuredOnce && !hasCachedMeasure(lastConstraints)) measure(lastConstraints);
     rect = bounds;
+    syncStore();
+    dirty = true;           // recorded display list is at the old place
+    layoutDirty = false;
+    remeasured = false;
+    hitIndexDirty = true;   // children may have moved
+    arrangeChildren(bounds);
+    updateDescendantBounds();
+}
 
+inline void Widget::arrangeChildren(const Rect& bounds) {
     if (layout) {
         layout->arrange(this, bounds);
     } else {
@@ -206,17 +806,86 @@ void Widget::arrange(const Rect& bounds){
     }
 }
 
-Widget Widget::clone() {
-    Widget copy;
-    copy.rect = this->rect;
-    copy.visible = this->visible;
-    copy.focusable = this->focusable;
-    if (this->layout) {
-        copy.layout = nullptr; 
-    }
-    for (const auto& child : this->children) {
-        copy.children.push_back(std::make_unique<Widget>(child->clone()));
-        copy.children.back()->parent = &copy;
+inline std::unique_ptr<Widget> Widget::clone() const {
+    std::vector<Widget*> tickers;
+    std::unique_ptr<Widget> copy = cloneTree(nullptr, tickers);
+    copy->focusAttachSubtree();   // one pass links the copy's focus order
+    if (!tickers.empty()) {
+        auto& list = copy->tree().tickers;
+        for (Widget* w : tickers) { w->ticking = true; list.push_back(w); }
     }
     return copy;
-}
\ No newline at end of file
+}
+
+inline std::unique_ptr<Widget> Widget::cloneTree(Widget* parentCopy, std::vector<Widget*>& tickers) const {
+    std::unique_ptr<Widget> copy = cloneSelf();
+    // a sliced copy would silently lose the subclass: refuse in every build
+    if (typeid(*copy) != typeid(*this))
+        throw std::logic_error(std::string("Widget::clone(): ") + typeid(*this).name() + " does not override cloneSelf()");
+    copy->parent = parentCopy;
+    copy->subtreeSize = subtreeSize;
+    copy->children.reserve(children.size());
+    for (const auto& c : children) copy->children.push_back(c->cloneTree(copy.get(), tickers));
+    if (layout) copy->layout = layout->clone(*this, *copy);
+    if (ticking) tickers.push_back(copy.get());
+    copy->onCloned(*this);
+    return copy;
+}
+
+
+// ---------- TreeStore (needs Widget) ----------
+inline void TreeStore::rebuild(Widget* root) {
+    detach();
+    // iterative pre-order walk; the stack keeps (widget, parent index)
+    std::vector<std::pair<Widget*, uint32_t>> stack{{root, NONE}};
+    while (!stack.empty()) {
+        auto [w, p] = stack.back();
+        stack.pop_back();
+        uint32_t i = (uint32_t)node.size();
+        node.push_back(w);
+        parent.push_back(p);
+        firstChild.push_back(NONE);
+        nextSibling.push_back(NONE);
+        end.push_back(i + 1);
+        depth.push_back(p == NONE ? 0 : depth[p] + 1);
+        rect.push_back({});
+        offsetX.push_back(0);
+        offsetY.push_back(0);
+        flags.push_back(0);
+        w->store = this;
+        w->storeIndex = i;
+        sync(i, *w);
+        for (size_t k = w->children.size(); k-- > 0;) stack.push_back({w->children[k].get(), i});
+    }
+    // links and subtree ends, children before parents
+    for (uint32_t i = (uint32_t)node.size(); i-- > 1;) {
+        uint32_t p = parent[i];
+        nextSibling[i] = firstChild[p];
+        firstChild[p] = i;
+        end[p] = std::max(end[p], end[i]);
+    }
+    stale = false;
+}
+
+inline void TreeStore::sync(uint32_t i, const Widget& w) {
+    const Rect& r = w.rect;
+    rect[i] = { (int32_t)r.x, (int32_t)r.y, (int32_t)(r.x + r.w), (int32_t)(r.y + r.h) };
+    offsetX[i] = w.childOffsetX();
+    offsetY[i] = w.childOffsetY();
+    flags[i] = (w.visible ? NODE_VISIBLE : 0) | (w.focusable ? NODE_FOCUSABLE : 0);
+}
+
+inline void TreeStore::detach() {
+    for (Widget* w : node) w->store = nullptr;
+    node.clear();
+    parent.clear();
+    firstChild.clear();
+    nextSibling.clear();
+    end.clear();
+    depth.clear();
+    rect.clear();
+    offsetX.clear();
+    offsetY.clear();
+    flags.clear();
+    stale = true;
+}
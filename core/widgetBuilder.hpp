@@ -49,6 +49,7 @@ public:
 
     WidgetBuilder& layout(std::unique_ptr<Layout> l) {
         rootWidget->layout = std::move(l);
+        rootWidget->markLayoutDirty();
         return *this;
     }
 
@@ -56,6 +57,7 @@ public:
     requires std::is_base_of_v<Layout, LayoutT>
     WidgetBuilder& layout() {
         rootWidget->layout = std::make_unique<LayoutT>();
+        rootWidget->markLayoutDirty();
         return *this;
     }
 
@@ -64,6 +66,7 @@ public:
             std::function<void(Widget*)> f;
             CallbackWidget(std::function<void(Widget*)> func) : f(func) {}
             void onClick(int, int) override { if(f) f(this); }
+            std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<CallbackWidget>(*this); }
         };
         auto cbWidget = std::make_unique<CallbackWidget>(cb);
         cbWidget->rect = {0, 0, rootWidget->rect.w, rootWidget->rect.h};
@@ -116,6 +119,14 @@ public:
     }
     
 
+    // everything fn allocates (widgets, layouts) comes from arena; the
+    // returned tree must be destroyed before the arena is reset
+    template <typename Fn>
+    static std::unique_ptr<Widget> buildIn(WidgetArena& arena, Fn&& fn) {
+        WidgetArena::Scope scope(arena);
+        return std::invoke(std::forward<Fn>(fn));
+    }
+
     //default with layout
     template <typename LayoutT>
     requires std::is_base_of_v<Layout, LayoutT>
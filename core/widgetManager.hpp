@@ -1,9 +1,15 @@
 #pragma once
 #include "widget.hpp"
-// #include "renderer.hpp"
+#include "renderer.hpp"
+#include "parallelLayout.hpp"
 #include <algorithm>
 
-class Renderer;
+// key codes (same values as Win32 VK_*)
+enum Key : int {
+    KEY_TAB = 0x09,
+    KEY_SHIFT = 0x10,
+    KEY_ESCAPE = 0x1B,
+};
 
 class WidgetManager {
 public:
@@ -14,9 +20,21 @@ public:
     Widget* activeTarget = nullptr;
     Widget* focusTarget = nullptr;
 
+    bool shiftDown = false;
+
+    bool laidOut = false;
+    LayoutConstraints lastRootConstraint;
+
+    bool fullRepaint = true;
+    DamageRegion lastDamage;
+
+    std::vector<Widget*> hitPath;   // root .. last hit widget
+
     WidgetManager(std::unique_ptr<Widget> r, Renderer* ren) : root(std::move(r)), renderer(ren) {
         LOG("WidgetManager created");
         if(root) LOG("root widget exists");
+        // measure text with the same backend that draws it
+        if (renderer) setTextMeasurer(&renderer->measurer());
     }
 
     ~WidgetManager() {
@@ -28,16 +46,143 @@ public:
         return root->measure(c);
     }
 
+    // Incremental: only the relayout boundaries queued by markLayoutDirty() are
+    // re-measured/arranged; a new root constraint forces a full pass.
     void performLayout(LayoutConstraints rootConstraint) {
+        PROF_SCOPE("layout", PHASE_LAYOUT);
+        std::vector<Widget*> queue = root->takeRelayoutQueue();
+        if (!laidOut || !(rootConstraint == lastRootConstraint)) {
+            layoutRoot(rootConstraint);
+            return;
+        }
+
+        // shallowest first: a deeper boundary inside an already laid out subtree is clean by then
+        std::vector<std::pair<int, Widget*>> ordered;
+        ordered.reserve(queue.size());
+        for (Widget* w : queue) {
+            int depth = 0;
+            for (Widget* p = w->parent; p; p = p->parent) ++depth;
+            ordered.push_back({depth, w});
+        }
+        std::sort(ordered.begin(), ordered.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        for (auto& [depth, w] : ordered) {
+            if (!w->isLayoutDirty()) continue;
+            PROF_COUNT(RELAYOUT_BOUNDARIES);
+            if (w == root.get()) {
+                layoutRoot(rootConstraint);
+            } else {
+                // children may move anywhere (even outside the boundary's rect):
+                // damage what the subtree drew before and draws after
+                root->addDamage(w->windowDrawBounds());
+                w->measure(w->getLastConstraints());
+                w->arrange(w->rect);
+                w->growAncestorBounds();
+                w->markDirty();   // damages the new bounds; ancestors' display lists are stale too
+            }
+        }
+    }
+
+    // fan out child measure of big subtrees over a TaskPool (see measureChildren);
+    // workers == 0 uses every core
+    void useParallelLayout(bool on = true, unsigned workers = 0) { setParallelLayout(on, workers); }
+
+    void layoutRoot(const LayoutConstraints& rootConstraint) {
         Size desired = root->measure(rootConstraint);
         Rect rootRect { 0, 0, desired.w, desired.h };
         root->arrange(rootRect);
-        root->clearLayoutDirty();
+        laidOut = true;
+        lastRootConstraint = rootConstraint;
+        fullRepaint = true;
+    }
+
+    // mirror the tree into a flat TreeStore (structure-of-arrays); hit testing
+    // and focus traversal then scan arrays instead of chasing child pointers
+    void useTreeStore(bool on = true) {
+        root->enableTreeStore(on);
+        hitPath.clear();
+    }
+
+    // ---------- Paint ----------
+    // Repaints only the damaged region: one clipped pass per damage rect,
+    // widgets outside the clip are skipped. Returns false when nothing was drawn.
+    bool render() {
+        PROF_SCOPE("paint", PHASE_PAINT);
+        if (!renderer) return false;
+        DamageRegion damage = root->takeDamage();
+        if (fullRepaint) {
+            damage.clear();
+            damage.add(root->windowDrawBounds());
+            fullRepaint = false;
+        }
+        lastDamage = damage;
+        if (damage.empty()) return false;
+
+        renderer->beginFrame();
+        for (const Rect& d : damage.rects()) {
+            renderer->pushClip(d);
+            root->paint(*renderer);
+            renderer->popClip();
+        }
+        renderer->endFrame();
+        root->clearDirtyFlag();
+        return true;
+    }
+
+    // retained display lists: dirty subtrees are recorded, clean ones replayed
+    // without calling draw(); the root's list is the frame (see frameList)
+    void useDisplayLists(bool on = true) {
+        if (!renderer || renderer->isRetained() == on) return;
+        renderer->setRetained(on);
+        root->dropDisplayLists();
+        fullRepaint = true;
+    }
+
+    // last recorded frame, e.g. frameList()->serialize() to diff two frames
+    std::shared_ptr<const DisplayList> frameList() const { return root->getDisplayList(); }
+
+    // force the next render() to repaint the whole root (e.g. window resize, WM_PAINT)
+    void invalidateAll() { fullRepaint = true; }
+
+    // rects painted by the last render(), e.g. to pass to InvalidateRect/present
+    const DamageRegion& paintedRegion() const { return lastDamage; }
+
+    // ---------- Hit testing ----------
+    // Reuses the path to the last hit (root .. target): while each level still
+    // contains the point and its siblings can't overlap it, no children are scanned.
+    Widget* hitTest(int x, int y) {
+        // flat store: one linear scan of the packed rects, no path to keep
+        if (TreeStore* s = root->flatStore()) {
+            uint32_t i = s->hitTest(root->flatIndex(), x, y);
+            return i == TreeStore::NONE ? nullptr : s->node[i];
+        }
+        Widget* cur = root.get();
+        int lx = x, ly = y;   // point in cur's parent coordinates
+        if (!hitPath.empty() && hitPath.front() == cur && cur->rect.contains(x, y)) {
+            for (size_t i = 1; i < hitPath.size(); ++i) {
+                Widget* next = hitPath[i];
+                if (next->parent != cur || cur->childrenMayOverlap()) break;
+                int rx = lx - (int)cur->rect.x - cur->childOffsetX();
+                int ry = ly - (int)cur->rect.y - cur->childOffsetY();
+                if (!next->isVisible() || !next->rect.contains(rx, ry)) break;
+                cur = next;
+                lx = rx;
+                ly = ry;
+            }
+        }
+        Widget* hit = cur->hitTest(lx, ly);
+
+        hitPath.clear();
+        for (Widget* w = hit; w; w = w->parent) hitPath.push_back(w);
+        std::reverse(hitPath.begin(), hitPath.end());
+        return hit;
     }
 
     // ---------- Mouse ----------
     void onMouseMove(int x, int y) {
-        Widget* hit = root->hitTest(x, y);
+        PROF_SCOPE("onMouseMove", PHASE_EVENT);
+        Widget* hit = hitTest(x, y);
         if (hit != hoverTarget) {
             if (hoverTarget) hoverTarget->onMouseLeave();
             hoverTarget = hit;
@@ -47,8 +192,9 @@ public:
     }
 
     void onMouseDown(int x, int y, int button) {
+        PROF_SCOPE("onMouseDown", PHASE_EVENT);
         LOG("WidgetManager onMouseDown at x:" << x << " y:" << y);
-        Widget* hit = root->hitTest(x, y);
+        Widget* hit = hitTest(x, y);
         if (hit) {
             Rect bound = hit->rect;
             LOG(" Hit widget at rect x:" << bound.x << " y:" << bound.y << " w:" << bound.w << " h:" << bound.h);
@@ -59,8 +205,9 @@ public:
     }
 
     void onMouseUp(int x, int y, int button) {
-        Widget* hit = root->hitTest(x, y);
+        PROF_SCOPE("onMouseUp", PHASE_EVENT);
         if (activeTarget) {
+            Widget* hit = hitTest(x, y);
             activeTarget->onMouseUp(x, y, button);
             if (hit == activeTarget) hit->onClick(x, y);
             activeTarget = nullptr;
@@ -68,6 +215,7 @@ public:
     }
 
     void onScrollWheel(int delta) {
+        PROF_SCOPE("onScrollWheel", PHASE_EVENT);
         // gửi sự kiện cho widget dưới chuột nếu có, hoặc widget focus
         if (hoverTarget) hoverTarget->onScroll(delta);
         else if (focusTarget) focusTarget->onScroll(delta);
@@ -89,45 +237,56 @@ public:
         }
     }
 
+    // Tab order comes from the tree's incremental focus index: O(1) per press
     void focusNext(bool reverse = false) {
-        std::vector<Widget*> focusables;
-        root->collectFocusable(focusables);
-        if (focusables.empty()) return;
-
-        auto it = std::find(focusables.begin(), focusables.end(), focusTarget);
-        if (it == focusables.end()) {
-            setFocus(focusables.front());
-            return;
-        }
+        WidgetTreeState& t = root->tree();
+        if (!t.focusHead) return;
 
-        if (reverse) {
-            if (it == focusables.begin()) it = focusables.end();
-            --it;
-        } else {
-            ++it;
-            if (it == focusables.end()) it = focusables.begin();
-        }
-        setFocus(*it);
+        Widget* next = nullptr;
+        if (focusTarget && focusTarget->isInFocusOrder())
+            next = reverse ? focusTarget->prevInFocusOrder() : focusTarget->nextInFocusOrder();
+        else next = t.focusHead;
+        if (!next) next = reverse ? t.focusTail : t.focusHead;   // wrap around
+        setFocus(next);
     }
 
     // ---------- Keyboard ----------
     void onKeyDown(int key) {
-        if (key == VK_TAB) { focusNext((GetKeyState(VK_SHIFT) & 0x8000) != 0); return; }
-        if (key == VK_ESCAPE) clearFocus();
+        PROF_SCOPE("onKeyDown", PHASE_EVENT);
+        if (key == KEY_SHIFT) shiftDown = true;
+        if (key == KEY_TAB) { focusNext(shiftDown); return; }
+        if (key == KEY_ESCAPE) clearFocus();
         if (focusTarget) focusTarget->onKeyDown(key);
     }
 
     void onKeyUp(int key) {
+        PROF_SCOPE("onKeyUp", PHASE_EVENT);
+        if (key == KEY_SHIFT) shiftDown = false;
         if (focusTarget) focusTarget->onKeyUp(key);
     }
 
     void onChar(wchar_t c) {
+        PROF_SCOPE("onChar", PHASE_EVENT);
         if (focusTarget) focusTarget->onChar(c);
     }
 
     // ---------- Frame tick ----------
+    // One frame: ticks the subscribed widgets only (Widget::startTicking), then
+    // one layout + one paint for everything invalidated since the last frame.
+    // Returns true while another frame is wanted (something still ticks).
     bool tick(double dt) {
-        root->update(dt);
-        return true;
+        {
+            PROF_SCOPE("update", PHASE_OTHER);
+            for (Widget* w : root->takeTickers()) {
+                if (w->isTicking()) w->update(dt);
+            }
+        }
+        if (laidOut) performLayout(lastRootConstraint);
+        render();
+        PROF_END_FRAME();
+        return !root->takeTickers().empty();
     }
+
+    // nothing to tick, lay out or paint: the app can block on input
+    bool isIdle() { return !fullRepaint && !root->hasPendingFrameWork(); }
 };
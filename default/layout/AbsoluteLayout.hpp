@@ -1,6 +1,7 @@
-#pragma one
-#include "../core/layout.hpp"
-#include "../core/widget.hpp"
+#pragma once
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/parallelLayout.hpp"
 
 
 // AbsoluteLayout
@@ -9,6 +10,7 @@ public:
     Size measure(Widget* widget, const LayoutConstraints& c) override {
         // measure children if needed; default: prefer container current size
         double w = 0, h = 0;
+        measureChildren(widget, LayoutConstraints::Unbounded());
         for (auto &childPtr : widget->children) {
             Widget* child = childPtr.get();
             Size s = child->measure(LayoutConstraints::Unbounded());
@@ -19,6 +21,10 @@ public:
         return { clampDouble(w, c.minW, c.maxW), clampDouble(h, c.minH, c.maxH) };
     }
 
+    std::unique_ptr<Layout> clone(const Widget&, Widget&) const override {
+        return std::make_unique<AbsoluteLayout>(*this);
+    }
+
     void arrange(Widget* widget, const Rect& bounds) override {
         LOG("AbsoluteLayout arrange in bounds x:" << bounds.x << " y:" << bounds.y << " w:" << bounds.w << " h:" << bounds.h);
         for (auto &childPtr : widget->children) {
@@ -1,6 +1,6 @@
-#pragma one
-#include "../core/layout.hpp"
-#include "../core/widget.hpp"
+#pragma once
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
 
 
 // DockLayout
@@ -31,13 +31,24 @@ public:
         return { clampDouble(totalW, c.minW, c.maxW), clampDouble(totalH, c.minH, c.maxH) };
     }
 
+    // docked widgets are children of the owner: point at the copy's children
+    std::unique_ptr<Layout> clone(const Widget& source, Widget& copy) const override {
+        auto l = std::make_unique<DockLayout>(*this);
+        l->dockChildren.clear();
+        for (const auto& dc : dockChildren) {
+            // entries for widgets that aren't source's children are dropped
+            if (Widget* mapped = copy.correspondingChild(source, dc.widget)) l->dockChildren.push_back({ mapped, dc.dock });
+        }
+        return l;
+    }
+
     void arrange(Widget* widget, const Rect& bounds) override {
         Rect rem = {0, 0, bounds.w, bounds.h};
 
         for (auto &dc : dockChildren) {
             Widget* w = dc.widget;
             Rect r;
-            Size pref = w->measure(LayoutConstraints::Unbounded());
+            Size pref = w->measure(LayoutConstraints::Unbounded()); // served from the measure cache after the first pass
 
             switch(dc.dock) {
                 case Dock::Left:
@@ -1,8 +1,12 @@
-#pragma one
-#include "../core/layout.hpp"
-#include "../core/widget.hpp"
+#pragma once
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/parallelLayout.hpp"
 
-// FlowLayout
+// FlowLayout: children left to right, wrapping to a new line when the next
+// one does not fit. measure records the line breaks and arrange reuses them;
+// after children are appended/removed/resized only the lines from the first
+// changed child onward are wrapped again.
 class FlowLayout : public Layout {
 public:
     double spacing = 4.0;
@@ -10,52 +14,115 @@ public:
     double padding = 4.0;
     bool wrap = true;
 
-    Size measure(Widget* widget, const LayoutConstraints& c) override {
+    std::unique_ptr<Layout> clone(const Widget&, Widget&) const override {
+        auto l = std::make_unique<FlowLayout>();
+        l->spacing = spacing;
+        l->lineSpacing = lineSpacing;
+        l->padding = padding;
+        l->wrap = wrap;
+        return l;
+    }
 
-        double x = padding-spacing, y = padding, maxHeightLine = 0;
-        double totalW = 0, totalH = 0;
+    Size measure(Widget* widget, const LayoutConstraints& c) override {
         LOG("FlowLayout measure with Width:" << c.maxW);
+        auto& kids = widget->children;
+        measureChildren(widget, LayoutConstraints::Unbounded());
 
-        for (auto &childPtr : widget->children) {
-            Widget* child = childPtr.get();
-            Size s =child->measure(LayoutConstraints::Unbounded());
-
-            if (wrap && x + s.w  + padding> c.maxW) {
-                x = padding - spacing;
-                y += maxHeightLine + lineSpacing;
-                maxHeightLine = 0;
+        // keep the breaks before the first child that is new or changed size
+        size_t from = sameParams(c.maxW) ? std::min(items.size(), kids.size()) : 0;
+        for (size_t i = 0; i < from; ++i) {
+            if (kids[i].get() != items[i].w || !sameSize(kids[i]->measure(LayoutConstraints::Unbounded()), items[i].s)) {
+                from = i;
+                break;
             }
-            x += spacing + s.w;
-            maxHeightLine = std::max(maxHeightLine, s.h);
-            totalW = std::max(totalW, x+padding);
-            totalH = y + maxHeightLine;
         }
-        totalH += lineSpacing; // bottom spacing
-        LOG("FlowLayout measure totalW:" << totalW << " totalH:" << totalH);
-        return { clampDouble(totalW, c.minW, c.maxW), clampDouble(totalH, c.minH, c.maxH) };
+        if (from < kids.size() || from < items.size() || lines.empty()) {
+            items.resize(kids.size());
+            for (size_t i = from; i < kids.size(); ++i)
+                items[i] = { kids[i].get(), kids[i]->measure(LayoutConstraints::Unbounded()), 0, 0 };
+            reflow(from, c.maxW);
+        }
+
+        Size out = contentSize();
+        LOG("FlowLayout measure totalW:" << out.w << " totalH:" << out.h);
+        return { clampDouble(out.w, c.minW, c.maxW), clampDouble(out.h, c.minH, c.maxH) };
     }
 
     void arrange(Widget* widget, const Rect& bounds) override {
         LOG("FlowLayout arrange in bounds x:" << bounds.x << " y:" << bounds.y << " w:" << bounds.w << " h:" << bounds.h);
-        double x = spacing, y = lineSpacing;
-        double lineHeight = 0;
+        if (items.size() != widget->children.size()) measure(widget, { 0, 0, bounds.w, bounds.h });
 
-        for (auto &childPtr : widget->children) {
-            Widget* child = childPtr.get();
-            Size s = childPtr->meansureSize;
+        // greedy breaks are the same for any width in [content width, wrap width]
+        if (wrap && (bounds.w < contentSize().w || bounds.w > flowWidth)) reflow(0, bounds.w);
 
-            if (wrap && x + s.w > bounds.w) {
-                x = spacing;
-                y += lineHeight + lineSpacing;
-                lineHeight = 0;
-            }
+        for (const Item& it : items) {
+            const Line& line = lines[it.line];
+            it.w->arrange({ it.x, line.y, it.s.w, it.s.h });
+        }
+    }
 
+private:
+    struct Item {
+        Widget* w;
+        Size s;          // measured size
+        double x;
+        uint32_t line;
+    };
+    struct Line {
+        size_t first;    // first item
+        double y, h;
+        double right;    // end of the last item
+    };
 
-            Rect r { x, y, s.w, s.h };
-            child->arrange(r);
+    std::vector<Item> items;   // child order
+    std::vector<Line> lines;
+    double flowWidth = -1;     // width the breaks were computed for
+    double flowSpacing = 0, flowLineSpacing = 0, flowPadding = 0;
+    bool flowWrap = true;
 
-            x += s.w + spacing;
-            lineHeight = std::max(lineHeight, s.h);
+    static bool sameSize(Size a, Size b) { return a.w == b.w && a.h == b.h; }
+
+    bool sameParams(double width) const {
+        return !lines.empty() && flowSpacing == spacing && flowLineSpacing == lineSpacing && flowPadding == padding
+            && flowWrap == wrap && (!wrap || width == flowWidth);
+    }
+
+    // wraps items from the start of the line holding item from-1; earlier lines stay
+    void reflow(size_t from, double width) {
+        size_t start = 0, lineIdx = 0;
+        if (from > 0 && sameParams(width)) {
+            lineIdx = items[from - 1].line;
+            start = lines[lineIdx].first;
+        }
+        lines.resize(lineIdx);
+        flowWidth = width;
+        flowSpacing = spacing;
+        flowLineSpacing = lineSpacing;
+        flowPadding = padding;
+        flowWrap = wrap;
+
+        double y = lines.empty() ? padding : lines.back().y + lines.back().h + lineSpacing;
+        if (start < items.size() || lines.empty()) lines.push_back({ start, y, 0, padding });
+        for (size_t i = start; i < items.size(); ++i) {
+            Item& it = items[i];
+            Line* line = &lines.back();
+            double x = line->first == i ? padding : line->right + spacing;
+            if (wrap && line->first != i && x + it.s.w + padding > width) {
+                lines.push_back({ i, line->y + line->h + lineSpacing, 0, padding });
+                line = &lines.back();
+                x = padding;
+            }
+            it.x = x;
+            it.line = (uint32_t)(lines.size() - 1);
+            line->right = x + it.s.w;
+            line->h = std::max(line->h, it.s.h);
         }
     }
-};
\ No newline at end of file
+
+    Size contentSize() const {
+        if (lines.empty()) return { 2 * padding, 2 * padding };
+        double w = 0;
+        for (const Line& l : lines) w = std::max(w, l.right);
+        return { w + padding, lines.back().y + lines.back().h + padding };
+    }
+};
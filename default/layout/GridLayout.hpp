@@ -1,9 +1,34 @@
-#pragma one
-#include "../core/layout.hpp"
-#include "../core/widget.hpp"
+#pragma once
+#include <cmath>
+#include <optional>
+#include <unordered_map>
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/cow.hpp"
+#include "../../core/parallelLayout.hpp"
 
 
-// GridLayout (uniform grid): 
+// size of one grid row/column
+struct GridLength {
+    enum class Unit { Fixed, Auto, Star };
+    Unit unit = Unit::Star;
+    double value = 1;   // Fixed: px, Star: weight
+
+    static GridLength fixed(double px) { return { Unit::Fixed, px }; }
+    static GridLength autoSize() { return { Unit::Auto, 0 }; }
+    static GridLength star(double weight = 1) { return { Unit::Star, weight }; }
+
+    bool operator==(const GridLength&) const = default;
+};
+
+// GridLayout: rows/columns of fixed, auto (content) or star (share of the
+// remaining space) size; children span one or more tracks. Children without
+// place() fill the cells in order, row by row. The default is a uniform grid
+// (every track star(1)).
+//
+// Each child is measured once per pass (auto columns first, so star columns
+// get their final width), track sizes are kept between passes and only the
+// tracks whose children changed size are recomputed.
 class GridLayout : public Layout {
 public:
     int rows = 1;
@@ -13,50 +38,292 @@ public:
 
     GridLayout(int r = 1, int c = 1) : rows(std::max(1, r)), cols(std::max(1, c)) {}
 
-    Size measure(Widget* widget, const LayoutConstraints& c) override {
-        // simple approach: measure children and compute max per column/row
-        std::vector<double> colW(cols, 0.0);
-        std::vector<double> rowH(rows, 0.0);
+    // configuration only: the copy solves its tracks again on first measure
+    GridLayout(const GridLayout& o)
+        : Layout(o), rows(o.rows), cols(o.cols), padding(o.padding), spacing(o.spacing), colDefs(o.colDefs),
+          rowDefs(o.rowDefs), placements(o.placements), revision(o.revision) {}
+    GridLayout(GridLayout&&) = default;
+    GridLayout& operator=(GridLayout&&) = default;
+    GridLayout& operator=(const GridLayout& o) { return *this = GridLayout(o); }
 
-        for (size_t i = 0; i < widget->children.size(); ++i) {
-            int r = (int)(i / cols);
-            int col = (int)(i % cols);
-            Widget* child = widget->children[i].get();
-            LayoutConstraints cc;
-            cc.maxW = c.maxW / cols;
-            cc.maxH = c.maxH / rows;
-            Size p = child->measure(cc);
-            colW[col] = std::max(colW[col], p.w);
-            rowH[r] = std::max(rowH[r], p.h);
+    void setColumns(std::vector<GridLength> defs) {
+        cols = std::max(1, (int)defs.size());
+        colDefs = std::move(defs);
+        ++revision;
+    }
+    void setRows(std::vector<GridLength> defs) {
+        rows = std::max(1, (int)defs.size());
+        rowDefs = std::move(defs);
+        ++revision;
+    }
+
+    // explicit cell of a child (clamped to the grid)
+    void place(Widget* w, int row, int col, int rowSpan = 1, int colSpan = 1) {
+        placements[w] = { row, col, std::max(1, rowSpan), std::max(1, colSpan) };
+        ++revision;
+    }
+
+    // track sizes of the last arrange
+    const std::vector<double>& columnWidths() const { return solved ? solved->colAxis.len : noTracks(); }
+    const std::vector<double>& rowHeights() const { return solved ? solved->rowAxis.len : noTracks(); }
+
+    std::unique_ptr<Layout> clone(const Widget& source, Widget& copy) const override {
+        auto l = std::make_unique<GridLayout>(rows, cols);
+        l->padding = padding;
+        l->spacing = spacing;
+        l->colDefs = colDefs;
+        l->rowDefs = rowDefs;
+        for (size_t i = 0; i < source.children.size() && i < copy.children.size(); ++i) {
+            auto it = placements.find(source.children[i].get());
+            if (it != placements.end()) l->placements[copy.children[i].get()] = it->second;
         }
+        return l;
+    }
 
-        Size out;
-        for (double w : colW) out.w += w;
-        for (double h : rowH) out.h += h;
+    Size measure(Widget* widget, const LayoutConstraints& c) override {
+        if (!upToDate(widget)) rebuild(widget);
+        auto& [cells, colAxis, rowAxis, builtRevision] = *solved;
+        const double inf = std::numeric_limits<double>::infinity();
 
-        out.w += 2*padding + spacing * (cols - 1);
-        out.h += 2*padding + spacing * (rows - 1);
+        // columns: children touching an auto column (or any column when the
+        // width is unbounded) first, then star columns at their final width
+        bool starColsKnown = std::isfinite(c.maxW);
+        bool starRowsKnown = std::isfinite(c.maxH) && !hasUnit(rowAxis, GridLength::Unit::Auto);
+        std::vector<double> rowAllot = allot(rowAxis, starRowsKnown ? c.maxH : inf);
+        std::vector<double> colAllot = allot(colAxis, inf);
+        for (int phase = 1; phase <= 2; ++phase) {
+            if (phase == 2) {
+                if (!starColsKnown) break;
+                resolve(colAxis, true);
+                colAllot = allot(colAxis, c.maxW);
+            }
+            auto constraintOf = [&](const Cell& cell) -> std::optional<LayoutConstraints> {
+                bool first = !starColsKnown || touches(colAxis, cell.col, cell.colSpan, GridLength::Unit::Auto);
+                if (first != (phase == 1)) return std::nullopt;
+                return LayoutConstraints{ 0, 0, spanOf(colAllot, cell.col, cell.colSpan), spanOf(rowAllot, cell.row, cell.rowSpan) };
+            };
+            measureChildrenWith(widget, [&](size_t i) { return constraintOf(cells[i]); });
+            for (Cell& cell : cells) {
+                std::optional<LayoutConstraints> cc = constraintOf(cell);
+                if (!cc) continue;
+                Size s = cell.w->measure(*cc);
+                if (cell.measured && s.w == cell.size.w && s.h == cell.size.h) continue;
+                // this cell's tracks need their content size again
+                markTracks(colAxis, cell.col, cell.colSpan);
+                markTracks(rowAxis, cell.row, cell.rowSpan);
+                cell.size = s;
+                cell.measured = true;
+            }
+        }
+        resolve(colAxis, true);
+        resolve(rowAxis, false);
 
+        Size out { total(colAxis), total(rowAxis) };
         out.w = clampDouble(out.w, c.minW, c.maxW);
         out.h = clampDouble(out.h, c.minH, c.maxH);
         return out;
     }
 
     void arrange(Widget* widget, const Rect& bounds) override {
-        // compute cell sizes (uniform from measure step)
-        double totalSpacingW = spacing * (cols - 1) + 2*padding;
-        double totalSpacingH = spacing * (rows - 1) + 2*padding;
-        double cellW = (bounds.w - totalSpacingW) / cols;
-        double cellH = (bounds.h - totalSpacingH) / rows;
+        if (!upToDate(widget)) measure(widget, { 0, 0, bounds.w, bounds.h });
+        auto& [cells, colAxis, rowAxis, builtRevision] = *solved;
+
+        // fixed/auto tracks keep their measured size, star tracks share the rest
+        layoutTracks(colAxis, bounds.w);
+        layoutTracks(rowAxis, bounds.h);
+        for (Cell& cell : cells) {
+            double x = colAxis.at[cell.col], y = rowAxis.at[cell.row];
+            int c1 = cell.col + cell.colSpan - 1, r1 = cell.row + cell.rowSpan - 1;
+            Rect cr { x, y, colAxis.at[c1] + colAxis.len[c1] - x, rowAxis.at[r1] + rowAxis.len[r1] - y };
+            cell.w->arrange(cr);
+        }
+    }
+
+private:
+    Cow<std::vector<GridLength>> colDefs;   // shared by clones; missing entries are star(1)
+    Cow<std::vector<GridLength>> rowDefs;
+
+    struct Placement { int row, col, rowSpan, colSpan; };
+    std::unordered_map<const Widget*, Placement> placements;
+    uint64_t revision = 0;
+
+    struct Cell {
+        Widget* w;
+        int row, col, rowSpan, colSpan;
+        Size size;                // desired size from the last measure
+        bool measured = false;
+    };
 
+    struct Axis {
+        std::vector<GridLength> defs;
+        std::vector<std::vector<uint32_t>> members;   // single-track cells per track
+        std::vector<uint32_t> spans;                  // cells spanning several tracks
+        std::vector<double> content;                  // largest single-track member, per track
+        std::vector<char> dirty;                      // content must be recomputed
+        std::vector<double> size;                     // desired size (content + spans)
+        std::vector<double> at, len;                  // arranged offset/size
+    };
+
+    // solver state, allocated on first measure: keeps the layout itself small
+    // (it is held by value in LayoutSlot)
+    struct Tracks {
+        std::vector<Cell> cells;   // one per child, in child order
+        Axis colAxis, rowAxis;
+        uint64_t builtRevision = ~0ull;
+    };
+    std::unique_ptr<Tracks> solved;
+
+    static const std::vector<double>& noTracks() {
+        static const std::vector<double> none;
+        return none;
+    }
+
+    bool upToDate(const Widget* widget) const {
+        if (!solved) return false;
+        const auto& [cells, colAxis, rowAxis, builtRevision] = *solved;
+        if (builtRevision != revision || cells.size() != widget->children.size()) return false;
+        if ((int)colAxis.defs.size() != cols || (int)rowAxis.defs.size() != rows) return false;
+        for (size_t i = 0; i < cells.size(); ++i)
+            if (cells[i].w != widget->children[i].get()) return false;
+        return true;
+    }
+
+    // children/placements/tracks changed: resolve every cell again
+    void rebuild(Widget* widget) {
+        if (!solved) solved = std::make_unique<Tracks>();
+        auto& [cells, colAxis, rowAxis, builtRevision] = *solved;
+        resetAxis(colAxis, *colDefs, cols);
+        resetAxis(rowAxis, *rowDefs, rows);
+        cells.clear();
+        cells.reserve(widget->children.size());
         for (size_t i = 0; i < widget->children.size(); ++i) {
-            int r = (int)(i / cols);
-            int col = (int)(i % cols);
-            double x =padding + col * (cellW + spacing);
-            double y =padding + r * (cellH + spacing);
-            Rect cr { x, y, cellW, cellH };
-            Widget* child = widget->children[i].get();
-            child->arrange(cr);
+            Widget* w = widget->children[i].get();
+            Placement p { (int)(i / cols), (int)(i % cols), 1, 1 };
+            auto it = placements.find(w);
+            if (it != placements.end()) p = it->second;
+            p.row = std::clamp(p.row, 0, rows - 1);
+            p.col = std::clamp(p.col, 0, cols - 1);
+            p.rowSpan = std::min(p.rowSpan, rows - p.row);
+            p.colSpan = std::min(p.colSpan, cols - p.col);
+            cells.push_back({ w, p.row, p.col, p.rowSpan, p.colSpan, Size{}, false });
+            addMember(colAxis, p.col, p.colSpan, (uint32_t)i);
+            addMember(rowAxis, p.row, p.rowSpan, (uint32_t)i);
+        }
+        builtRevision = revision;
+    }
+
+    static void resetAxis(Axis& a, const std::vector<GridLength>& defs, int n) {
+        a.defs.assign(n, GridLength::star());
+        for (int k = 0; k < n && k < (int)defs.size(); ++k) a.defs[k] = defs[k];
+        a.members.assign(n, {});
+        a.spans.clear();
+        a.content.assign(n, 0.0);
+        a.dirty.assign(n, 1);
+        a.size.assign(n, 0.0);
+        a.at.assign(n, 0.0);
+        a.len.assign(n, 0.0);
+    }
+
+    static void addMember(Axis& a, int first, int span, uint32_t cell) {
+        if (span == 1) a.members[first].push_back(cell);
+        else a.spans.push_back(cell);
+    }
+
+    static void markTracks(Axis& a, int first, int span) {
+        for (int k = first; k < first + span; ++k) a.dirty[k] = 1;
+    }
+
+    static bool touches(const Axis& a, int first, int span, GridLength::Unit u) {
+        for (int k = first; k < first + span; ++k) if (a.defs[k].unit == u) return true;
+        return false;
+    }
+
+    static bool hasUnit(const Axis& a, GridLength::Unit u) {
+        return touches(a, 0, (int)a.defs.size(), u);
+    }
+
+    double gaps(const Axis& a) const { return 2 * padding + spacing * (double)(a.defs.size() - 1); }
+
+    double total(const Axis& a) const {
+        double t = gaps(a);
+        for (double s : a.size) t += s;
+        return t;
+    }
+
+    // size a child may take per track before measuring: fixed tracks their
+    // value, star tracks their share of avail (when known), auto unbounded
+    std::vector<double> allot(const Axis& a, double avail) const {
+        const double inf = std::numeric_limits<double>::infinity();
+        std::vector<double> out(a.defs.size(), inf);
+        double rest = avail - gaps(a), weights = 0;
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            const GridLength& d = a.defs[k];
+            if (d.unit == GridLength::Unit::Fixed) { out[k] = d.value; rest -= d.value; }
+            else if (d.unit == GridLength::Unit::Auto) rest -= a.content[k];   // spans excluded: stable across passes
+            else weights += d.value;
+        }
+        if (!std::isfinite(avail) || weights <= 0) return out;
+        for (size_t k = 0; k < a.defs.size(); ++k)
+            if (a.defs[k].unit == GridLength::Unit::Star) out[k] = std::max(0.0, rest) * a.defs[k].value / weights;
+        return out;
+    }
+
+    double spanOf(const std::vector<double>& allotted, int first, int span) const {
+        double s = spacing * (span - 1);
+        for (int k = first; k < first + span; ++k) s += allotted[k];
+        return s;
+    }
+
+    // desired track sizes: content of dirty tracks, star tracks normalized to
+    // one size per weight, then spanning cells grow auto (else star) tracks
+    void resolve(Axis& a, bool horizontal) {
+        const std::vector<Cell>& cells = solved->cells;
+        auto extent = [horizontal](const Cell& c) { return horizontal ? c.size.w : c.size.h; };
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            if (!a.dirty[k]) continue;
+            double m = 0;
+            for (uint32_t i : a.members[k]) if (cells[i].measured) m = std::max(m, extent(cells[i]));
+            a.content[k] = m;
+            a.dirty[k] = 0;
+        }
+        double perWeight = 0;
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            const GridLength& d = a.defs[k];
+            if (d.unit == GridLength::Unit::Star && d.value > 0) perWeight = std::max(perWeight, a.content[k] / d.value);
+        }
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            const GridLength& d = a.defs[k];
+            a.size[k] = d.unit == GridLength::Unit::Fixed ? d.value
+                      : d.unit == GridLength::Unit::Star ? perWeight * d.value : a.content[k];
+        }
+        for (uint32_t i : a.spans) {
+            const Cell& c = cells[i];
+            if (!c.measured) continue;
+            int first = horizontal ? c.col : c.row, span = horizontal ? c.colSpan : c.rowSpan;
+            double have = spacing * (span - 1);
+            for (int k = first; k < first + span; ++k) have += a.size[k];
+            if (extent(c) <= have) continue;
+            GridLength::Unit grow = touches(a, first, span, GridLength::Unit::Auto) ? GridLength::Unit::Auto : GridLength::Unit::Star;
+            int n = 0;
+            for (int k = first; k < first + span; ++k) n += a.defs[k].unit == grow;
+            for (int k = first; k < first + span; ++k)
+                if (a.defs[k].unit == grow) a.size[k] += (extent(c) - have) / n;
+        }
+    }
+
+    void layoutTracks(Axis& a, double avail) {
+        double rest = avail - gaps(a), weights = 0;
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            if (a.defs[k].unit == GridLength::Unit::Star) weights += a.defs[k].value;
+            else rest -= a.size[k];
+        }
+        double pos = padding;
+        for (size_t k = 0; k < a.defs.size(); ++k) {
+            const GridLength& d = a.defs[k];
+            a.len[k] = d.unit != GridLength::Unit::Star ? a.size[k]
+                     : weights > 0 ? std::max(0.0, rest) * d.value / weights : 0;
+            a.at[k] = pos;
+            pos += a.len[k] + spacing;
         }
     }
 };
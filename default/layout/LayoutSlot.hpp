@@ -0,0 +1,78 @@
+#pragma once
+#include <type_traits>
+#include <variant>
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
+#include "AbsoluteLayout.hpp"
+#include "DockLayout.hpp"
+#include "FlowLayout.hpp"
+#include "GridLayout.hpp"
+#include "StackLayout.hpp"
+
+// -------------------------------
+// LayoutSlot: one of the built-in layouts stored inline in its widget
+// (LayoutPanel::setLayout). The set is closed, so dispatch is a std::visit over
+// the alternatives and a direct (qualified) call into the layout. There is
+// no heap block per container and no vtable call. Layouts outside the set
+// keep using Widget::layout.
+class LayoutSlot {
+public:
+    using Storage = std::variant<std::monostate, StackLayout, GridLayout, FlowLayout, DockLayout, AbsoluteLayout>;
+
+    // L is one of the built-in layouts the slot can hold
+    template <class L>
+    static constexpr bool holds = []<class... Ts>(std::variant<std::monostate, Ts...>*) {
+        return (std::is_same_v<L, Ts> || ...);
+    }((Storage*)nullptr);
+
+private:
+    Storage slot;
+
+public:
+    explicit operator bool() const { return slot.index() != 0; }
+
+    template <class L, class... Args>
+    requires holds<L>
+    L& emplace(Args&&... args) { return slot.template emplace<L>(std::forward<Args>(args)...); }
+
+    void reset() { slot.template emplace<std::monostate>(); }
+
+    template <class L> L* get() { return std::get_if<L>(&slot); }
+    template <class L> const L* get() const { return std::get_if<L>(&slot); }
+
+    // the held layout through its base (nullptr when empty)
+    Layout* get() {
+        return std::visit([](auto& l) -> Layout* {
+            if constexpr (std::is_same_v<std::decay_t<decltype(l)>, std::monostate>) return nullptr;
+            else return &l;
+        }, slot);
+    }
+
+    Size measure(Widget* widget, const LayoutConstraints& c) {
+        return std::visit([&](auto& l) -> Size {
+            using L = std::decay_t<decltype(l)>;
+            if constexpr (std::is_same_v<L, std::monostate>) return {};
+            else return l.L::measure(widget, c);
+        }, slot);
+    }
+
+    void arrange(Widget* widget, const Rect& bounds) {
+        std::visit([&](auto& l) {
+            using L = std::decay_t<decltype(l)>;
+            if constexpr (!std::is_same_v<L, std::monostate>) l.L::arrange(widget, bounds);
+        }, slot);
+    }
+
+    // after Widget::clone() copied the slot: the copy may still hold state about
+    // source's children (dock entries, grid placements, flow lines), so rebuild
+    // it from the layout's configuration as Layout::clone does
+    void remap(const Widget& source, Widget& copy) {
+        std::visit([&](auto& l) {
+            using L = std::decay_t<decltype(l)>;
+            if constexpr (!std::is_same_v<L, std::monostate>) {
+                std::unique_ptr<Layout> rebuilt = l.L::clone(source, copy);
+                l = std::move(static_cast<L&>(*rebuilt));
+            }
+        }, slot);
+    }
+};
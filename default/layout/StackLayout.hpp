@@ -1,6 +1,7 @@
-#pragma one
-#include "../core/layout.hpp"
-#include "../core/widget.hpp"
+#pragma once
+#include "../../core/layout.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/parallelLayout.hpp"
 
 // stack layout: vertical or horizontal stacking
 class StackLayout : public Layout {
@@ -18,16 +19,17 @@ public:
         Size result;
         double mainAvail = (orientation == Orientation::Vertical) ? c.maxH : c.maxW;
         // we'll pass unconstrained in main axis but constrained in cross axis
+        LayoutConstraints childConst = LayoutConstraints::Unbounded();
+        if (orientation == Orientation::Vertical) {
+            childConst.minW = c.minW;
+            childConst.maxW = c.maxW;
+        } else {
+            childConst.minH = c.minH;
+            childConst.maxH = c.maxH;
+        }
+        measureChildren(widget, childConst);   // parallel mode: fills the children's measure cache
         for (auto &childPtr : widget->children) {
             Widget* child = childPtr.get();
-            LayoutConstraints childConst = LayoutConstraints::Unbounded();
-            if (orientation == Orientation::Vertical) {
-                childConst.minW = c.minW;
-                childConst.maxW = c.maxW;
-            } else {
-                childConst.minH = c.minH;
-                childConst.maxH = c.maxH;
-            }
             Size pref = child->measure(childConst);
 
             if (orientation == Orientation::Vertical) {
@@ -58,6 +60,10 @@ public:
         return result;
     }
 
+    std::unique_ptr<Layout> clone(const Widget&, Widget&) const override {
+        return std::make_unique<StackLayout>(*this);
+    }
+
     void arrange(Widget* widget, const Rect& bounds) override {
 
         // compute area for children (inside padding)
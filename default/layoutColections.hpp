@@ -1,4 +1,4 @@
-#pragma one
+#pragma once
 #include "../core/layout.hpp"
 #include "../core/widget.hpp"
 
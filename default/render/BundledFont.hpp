@@ -0,0 +1,727 @@
+#pragma once
+#include <cstdint>
+
+// Generated by tools/gen_bundled_font.py - do not edit.
+//
+// Glyph outlines: subset of DejaVu Sans (renamed as required by the license).
+// Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved.
+// Bitstream Vera is a trademark of Bitstream, Inc.
+// DejaVu changes are in public domain.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of the fonts accompanying this license ("Fonts") and associated
+// documentation files (the "Font Software"), to reproduce and distribute the
+// Font Software, including without limitation the rights to use, copy, merge,
+// publish, distribute, and/or sell copies of the Font Software, and to permit
+// persons to whom the Font Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright and trademark notices and this permission notice shall
+// be included in all copies of one or more of the Font Software typefaces.
+//
+// The Font Software may be modified, altered, or added to, and in particular
+// the designs of glyphs or characters in the Fonts may be modified and
+// additional glyphs or characters may be added to the Fonts, only if the fonts
+// are renamed to names not containing either the words "Bitstream" or the word
+// "Vera".
+//
+// This License becomes null and void to the extent applicable to Fonts or Font
+// Software that has been modified and is distributed under the "Bitstream
+// Vera" names.
+//
+// The Font Software may be sold as part of a larger software package but no
+// copy of one or more of the Font Software typefaces may be sold by itself.
+//
+// THE FONT SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO ANY WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT OF COPYRIGHT, PATENT,
+// TRADEMARK, OR OTHER RIGHT. IN NO EVENT SHALL BITSTREAM OR THE GNOME
+// FOUNDATION BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, INCLUDING
+// ANY GENERAL, SPECIAL, INDIRECT, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+// THE USE OR INABILITY TO USE THE FONT SOFTWARE OR FROM OTHER DEALINGS IN THE
+// FONT SOFTWARE.
+//
+// Except as contained in this notice, the names of Gnome, the Gnome
+// Foundation, and Bitstream Inc., shall not be used in advertising or
+// otherwise to promote the sale, use or other dealings in this Font Software
+// without prior written authorization from the Gnome Foundation or Bitstream
+// Inc., respectively. For further information, contact: fonts at gnome dot
+// org.
+
+// Units are font units (unitsPerEm per em), y up from the baseline.
+namespace bundled_font {
+
+constexpr int unitsPerEm = 2048;
+constexpr int ascender = 1901;
+constexpr int descender = -483;
+constexpr int lineGap = 0;
+
+// per glyph: codepoint, advance, first part, part count; sorted by codepoint
+inline constexpr uint32_t glyphs[] = {
+    32, 651, 0, 0, 33, 821, 0, 1, 34, 942, 1, 1,
+    35, 1716, 2, 1, 36, 1303, 3, 1, 37, 1946, 4, 1,
+    38, 1597, 5, 1, 39, 563, 6, 1, 40, 799, 7, 1,
+    41, 799, 8, 1, 42, 1024, 9, 1, 43, 1716, 10, 1,
+    44, 651, 11, 1, 45, 739, 12, 1, 46, 651, 13, 1,
+    47, 690, 14, 1, 48, 1303, 15, 1, 49, 1303, 16, 1,
+    50, 1303, 17, 1, 51, 1303, 18, 1, 52, 1303, 19, 1,
+    53, 1303, 20, 1, 54, 1303, 21, 1, 55, 1303, 22, 1,
+    56, 1303, 23, 1, 57, 1303, 24, 1, 58, 690, 25, 1,
+    59, 690, 26, 1, 60, 1716, 27, 1, 61, 1716, 28, 1,
+    62, 1716, 29, 1, 63, 1087, 30, 1, 64, 2048, 31, 1,
+    65, 1401, 32, 1, 66, 1405, 33, 1, 67, 1430, 34, 1,
+    68, 1577, 35, 1, 69, 1294, 36, 1, 70, 1178, 37, 1,
+    71, 1587, 38, 1, 72, 1540, 39, 1, 73, 604, 40, 1,
+    74, 604, 41, 1, 75, 1343, 42, 1, 76, 1141, 43, 1,
+    77, 1767, 44, 1, 78, 1532, 45, 1, 79, 1612, 46, 1,
+    80, 1235, 47, 1, 81, 1612, 48, 1, 82, 1423, 49, 1,
+    83, 1300, 50, 1, 84, 1251, 51, 1, 85, 1499, 52, 1,
+    86, 1401, 53, 1, 87, 2025, 54, 1, 88, 1403, 55, 1,
+    89, 1251, 56, 1, 90, 1403, 57, 1, 91, 799, 58, 1,
+    92, 690, 59, 1, 93, 799, 60, 1, 94, 1716, 61, 1,
+    95, 1024, 62, 1, 96, 1024, 63, 1, 97, 1255, 64, 1,
+    98, 1300, 65, 1, 99, 1126, 66, 1, 100, 1300, 67, 1,
+    101, 1260, 68, 1, 102, 721, 69, 1, 103, 1300, 70, 1,
+    104, 1298, 71, 1, 105, 569, 72, 1, 106, 569, 73, 1,
+    107, 1186, 74, 1, 108, 569, 75, 1, 109, 1995, 76, 1,
+    110, 1298, 77, 1, 111, 1253, 78, 1, 112, 1300, 79, 1,
+    113, 1300, 80, 1, 114, 842, 81, 1, 115, 1067, 82, 1,
+    116, 803, 83, 1, 117, 1298, 84, 1, 118, 1212, 85, 1,
+    119, 1675, 86, 1, 120, 1212, 87, 1, 121, 1212, 88, 1,
+    122, 1075, 89, 1, 123, 1303, 90, 1, 124, 690, 91, 1,
+    125, 1303, 92, 1, 126, 1716, 93, 1, 160, 651, 94, 0,
+    161, 821, 94, 1, 162, 1303, 95, 1, 163, 1303, 96, 1,
+    164, 1303, 97, 1, 165, 1303, 98, 1, 166, 690, 99, 1,
+    167, 1024, 100, 1, 168, 1024, 101, 1, 169, 2048, 102, 1,
+    170, 965, 103, 1, 171, 1253, 104, 1, 172, 1716, 105, 1,
+    173, 739, 106, 1, 174, 2048, 107, 1, 175, 1024, 108, 1,
+    176, 1024, 109, 1, 177, 1716, 110, 1, 178, 821, 111, 1,
+    179, 821, 112, 1, 180, 1024, 113, 1, 181, 1303, 114, 1,
+    182, 1303, 115, 1, 183, 651, 116, 1, 184, 1024, 117, 1,
+    185, 821, 118, 1, 186, 965, 119, 1, 187, 1253, 120, 1,
+    188, 1985, 121, 3, 189, 1985, 124, 3, 190, 1985, 127, 3,
+    191, 1087, 130, 1, 192, 1401, 131, 2, 193, 1401, 133, 2,
+    194, 1401, 135, 2, 195, 1401, 137, 2, 196, 1401, 139, 2,
+    197, 1401, 141, 1, 198, 1995, 142, 1, 199, 1430, 143, 2,
+    200, 1294, 145, 2, 201, 1294, 147, 2, 202, 1294, 149, 2,
+    203, 1294, 151, 2, 204, 604, 153, 2, 205, 604, 155, 2,
+    206, 604, 157, 2, 207, 604, 159, 2, 208, 1587, 161, 1,
+    209, 1532, 162, 2, 210, 1612, 164, 2, 211, 1612, 166, 2,
+    212, 1612, 168, 2, 213, 1612, 170, 2, 214, 1612, 172, 2,
+    215, 1716, 174, 1, 216, 1612, 175, 1, 217, 1499, 176, 2,
+    218, 1499, 178, 2, 219, 1499, 180, 2, 220, 1499, 182, 2,
+    221, 1251, 184, 2, 222, 1239, 186, 1, 223, 1290, 187, 1,
+    224, 1255, 188, 2, 225, 1255, 190, 2, 226, 1255, 192, 2,
+    227, 1255, 194, 2, 228, 1255, 196, 2, 229, 1255, 198, 2,
+    230, 2011, 200, 1, 231, 1126, 201, 2, 232, 1260, 203, 2,
+    233, 1260, 205, 2, 234, 1260, 207, 2, 235, 1260, 209, 2,
+    236, 569, 211, 2, 237, 569, 213, 2, 238, 569, 215, 2,
+    239, 569, 217, 2, 240, 1253, 219, 1, 241, 1298, 220, 2,
+    242, 1253, 222, 2, 243, 1253, 224, 2, 244, 1253, 226, 2,
+    245, 1253, 228, 2, 246, 1253, 230, 2, 247, 1716, 232, 1,
+    248, 1253, 233, 1, 249, 1298, 234, 2, 250, 1298, 236, 2,
+    251, 1298, 238, 2, 252, 1298, 240, 2, 253, 1212, 242, 2,
+    254, 1300, 244, 1, 255, 1212, 245, 2, 258, 1401, 247, 2,
+    259, 1255, 249, 2, 272, 1587, 251, 1, 273, 1300, 252, 1,
+    296, 604, 253, 2, 297, 569, 255, 2, 360, 1499, 257, 2,
+    361, 1298, 259, 2, 416, 1870, 261, 2, 417, 1253, 263, 2,
+    431, 1757, 265, 2, 432, 1298, 267, 2, 7840, 1401, 269, 2,
+    7841, 1255, 271, 2, 7842, 1401, 273, 2, 7843, 1255, 275, 2,
+    7844, 1401, 277, 3, 7845, 1255, 280, 3, 7846, 1401, 283, 3,
+    7847, 1255, 286, 3, 7848, 1401, 289, 3, 7849, 1255, 292, 3,
+    7850, 1401, 295, 3, 7851, 1255, 298, 3, 7852, 1401, 301, 3,
+    7853, 1255, 304, 3, 7854, 1401, 307, 3, 7855, 1255, 310, 3,
+    7856, 1401, 313, 3, 7857, 1255, 316, 3, 7858, 1401, 319, 3,
+    7859, 1255, 322, 3, 7860, 1401, 325, 3, 7861, 1255, 328, 3,
+    7862, 1401, 331, 3, 7863, 1255, 334, 3, 7864, 1294, 337, 2,
+    7865, 1260, 339, 2, 7866, 1294, 341, 2, 7867, 1260, 343, 2,
+    7868, 1294, 345, 2, 7869, 1260, 347, 2, 7870, 1294, 349, 3,
+    7871, 1260, 352, 3, 7872, 1294, 355, 3, 7873, 1260, 358, 3,
+    7874, 1294, 361, 3, 7875, 1260, 364, 3, 7876, 1294, 367, 3,
+    7877, 1260, 370, 3, 7878, 1294, 373, 3, 7879, 1260, 376, 4,
+    7880, 604, 380, 2, 7881, 569, 382, 2, 7882, 604, 384, 2,
+    7883, 569, 386, 2, 7884, 1612, 388, 2, 7885, 1253, 390, 2,
+    7886, 1612, 392, 2, 7887, 1253, 394, 2, 7888, 1612, 396, 3,
+    7889, 1253, 399, 3, 7890, 1612, 402, 3, 7891, 1253, 405, 3,
+    7892, 1612, 408, 3, 7893, 1253, 411, 3, 7894, 1612, 414, 3,
+    7895, 1253, 417, 3, 7896, 1612, 420, 3, 7897, 1253, 423, 4,
+    7898, 1870, 427, 3, 7899, 1253, 430, 3, 7900, 1870, 433, 3,
+    7901, 1253, 436, 3, 7902, 1870, 439, 3, 7903, 1253, 442, 3,
+    7904, 1870, 445, 3, 7905, 1253, 448, 3, 7906, 1870, 451, 3,
+    7907, 1253, 454, 3, 7908, 1499, 457, 2, 7909, 1298, 459, 2,
+    7910, 1499, 461, 2, 7911, 1298, 463, 2, 7912, 1757, 465, 3,
+    7913, 1298, 468, 3, 7914, 1757, 471, 3, 7915, 1298, 474, 3,
+    7916, 1757, 477, 3, 7917, 1298, 480, 3, 7918, 1757, 483, 3,
+    7919, 1298, 486, 3, 7920, 1757, 489, 3, 7921, 1298, 492, 3,
+    7922, 1251, 495, 2, 7923, 1212, 497, 2, 7924, 1251, 499, 2,
+    7925, 1212, 501, 2, 7926, 1251, 503, 2, 7927, 1212, 505, 2,
+    7928, 1251, 507, 2, 7929, 1212, 509, 2, 8211, 1024, 511, 1,
+    8212, 2048, 512, 1, 8216, 651, 513, 1, 8217, 651, 514, 1,
+    8220, 1061, 515, 1, 8221, 1061, 516, 1, 8226, 1208, 517, 1,
+    8230, 2048, 518, 1, 8364, 1303, 519, 1, 65533, 2100, 520, 1,
+};
+
+// per part: outline, dx, dy (accented letters reuse the base and mark outlines)
+inline constexpr int16_t parts[] = {
+    0, 0, 0, 1, 0, 0, 2, 0, 0, 3, 0, 0, 4, 0, 0, 5, 0, 0,
+    6, 0, 0, 7, 0, 0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 11, 0, 0,
+    12, 0, 0, 13, 0, 0, 14, 0, 0, 15, 0, 0, 16, 0, 0, 17, 0, 0,
+    18, 0, 0, 19, 0, 0, 20, 0, 0, 21, 0, 0, 22, 0, 0, 23, 0, 0,
+    24, 0, 0, 25, 0, 0, 26, 0, 0, 27, 0, 0, 28, 0, 0, 29, 0, 0,
+    30, 0, 0, 31, 0, 0, 32, 0, 0, 33, 0, 0, 34, 0, 0, 35, 0, 0,
+    36, 0, 0, 37, 0, 0, 38, 0, 0, 39, 0, 0, 40, 0, 0, 41, 0, 0,
+    42, 0, 0, 43, 0, 0, 44, 0, 0, 45, 0, 0, 46, 0, 0, 47, 0, 0,
+    48, 0, 0, 49, 0, 0, 50, 0, 0, 51, 0, 0, 52, 0, 0, 53, 0, 0,
+    54, 0, 0, 55, 0, 0, 56, 0, 0, 57, 0, 0, 58, 0, 0, 59, 0, 0,
+    60, 0, 0, 61, 0, 0, 62, 0, 0, 63, 0, 0, 64, 0, 0, 65, 0, 0,
+    66, 0, 0, 67, 0, 0, 68, 0, 0, 69, 0, 0, 70, 0, 0, 71, 0, 0,
+    72, 0, 0, 73, 0, 0, 74, 0, 0, 75, 0, 0, 76, 0, 0, 77, 0, 0,
+    78, 0, 0, 79, 0, 0, 80, 0, 0, 81, 0, 0, 82, 0, 0, 83, 0, 0,
+    84, 0, 0, 85, 0, 0, 86, 0, 0, 87, 0, 0, 88, 0, 0, 89, 0, 0,
+    90, 0, 0, 91, 0, 0, 92, 0, 0, 93, 0, 0, 94, 0, 0, 95, 0, 0,
+    96, 0, 0, 97, 0, 0, 98, 0, 0, 99, 0, 0, 100, 0, 0, 101, 0, 0,
+    102, 0, 0, 103, 0, 0, 104, 0, 0, 105, 0, 0, 106, 0, 0, 107, 0, 0,
+    108, 0, 0, 109, 0, 0, 110, 0, 0, 111, 0, 0, 112, 0, 0, 113, 0, 0,
+    114, 0, 0, 115, 0, 0, 116, 0, 0, 117, 0, 0, 118, 0, 0, 119, 0, 0,
+    120, 0, 0, 118, 0, 0, 121, 1163, -668, 122, 821, 0, 118, 0, 0, 111, 1163, -668,
+    122, 821, 0, 112, 0, 0, 121, 1163, -668, 122, 821, 0, 123, 0, 0, 32, 0, 0,
+    124, 1212, 373, 32, 0, 0, 125, 1212, 373, 32, 0, 0, 126, 1212, 373, 32, 0, 0,
+    127, 1212, 373, 32, 0, 0, 128, 1212, 373, 129, 0, 0, 130, 0, 0, 34, 0, 0,
+    117, 301, 0, 36, 0, 0, 124, 1182, 373, 36, 0, 0, 125, 1182, 373, 36, 0, 0,
+    126, 1182, 373, 36, 0, 0, 128, 1182, 373, 40, 0, 0, 124, 815, 373, 40, 0, 0,
+    125, 815, 373, 40, 0, 0, 126, 815, 373, 40, 0, 0, 128, 815, 373, 131, 0, 0,
+    45, 0, 0, 127, 1278, 373, 46, 0, 0, 124, 1319, 373, 46, 0, 0, 125, 1319, 373,
+    46, 0, 0, 126, 1319, 373, 46, 0, 0, 127, 1319, 373, 46, 0, 0, 128, 1319, 373,
+    132, 0, 0, 133, 0, 0, 52, 0, 0, 124, 1262, 373, 52, 0, 0, 125, 1262, 373,
+    52, 0, 0, 126, 1262, 373, 52, 0, 0, 128, 1262, 373, 56, 0, 0, 125, 1139, 373,
+    134, 0, 0, 135, 0, 0, 64, 0, 0, 63, 82, 0, 64, 0, 0, 113, 82, 0,
+    64, 0, 0, 136, 82, 0, 64, 0, 0, 137, 82, 0, 64, 0, 0, 101, 82, 0,
+    64, 0, 0, 138, 82, 0, 139, 0, 0, 66, 0, 0, 117, 143, 0, 68, 0, 0,
+    63, 139, 0, 68, 0, 0, 113, 139, 0, 68, 0, 0, 136, 139, 0, 68, 0, 0,
+    101, 139, 0, 63, -227, 0, 140, 0, 0, 113, -227, 0, 140, 0, 0, 140, 0, 0,
+    136, -227, 0, 140, 0, 0, 101, -227, 0, 141, 0, 0, 77, 0, 0, 137, 152, 0,
+    78, 0, 0, 63, 115, 0, 78, 0, 0, 113, 115, 0, 78, 0, 0, 136, 115, 0,
+    78, 0, 0, 137, 115, 0, 78, 0, 0, 101, 115, 0, 142, 0, 0, 143, 0, 0,
+    84, 0, 0, 63, 123, 0, 84, 0, 0, 113, 123, 0, 84, 0, 0, 136, 123, 0,
+    84, 0, 0, 101, 123, 0, 88, 0, 0, 113, 94, 0, 144, 0, 0, 88, 0, 0,
+    101, 94, 0, 145, 206, 330, 32, 0, 0, 145, 79, -41, 64, 0, 0, 131, 0, 0,
+    146, 0, 0, 127, 814, 373, 40, 0, 0, 137, -227, 0, 140, 0, 0, 127, 1262, 373,
+    52, 0, 0, 137, 131, 0, 84, 0, 0, 46, -12, 0, 147, 1442, 308, 147, 1112, 11,
+    78, 5, 0, 52, -5, 20, 147, 1508, 308, 147, 1262, 11, 84, 2, 0, 148, 1207, 0,
+    32, 0, 0, 148, 1057, 0, 64, 0, 0, 32, 0, 0, 149, 1212, 373, 64, 0, 0,
+    149, 1108, 0, 32, 0, 0, 126, 1212, 373, 125, 1576, 580, 126, 1107, 0, 125, 1471, 207,
+    64, 0, 0, 32, 0, 0, 124, 1506, 580, 126, 1212, 373, 64, 0, 0, 124, 1398, 208,
+    126, 1104, 1, 32, 0, 0, 149, 1552, 480, 126, 1212, 373, 149, 1446, 107, 126, 1106, 0,
+    64, 0, 0, 32, 0, 0, 126, 1212, 373, 127, 1216, 652, 126, 1106, 0, 127, 1110, 279,
+    64, 0, 0, 32, 0, 0, 126, 1212, 373, 148, 1199, 0, 64, 0, 0, 136, 82, 0,
+    148, 1058, 0, 32, 0, 0, 150, 1212, 336, 125, 1264, 612, 150, 1101, -6, 125, 1153, 270,
+    64, 0, 0, 32, 0, 0, 150, 1212, 336, 124, 1164, 612, 150, 1102, -6, 124, 1054, 270,
+    64, 0, 0, 32, 0, 0, 149, 1195, 528, 150, 1212, 336, 149, 1087, 186, 150, 1104, -6,
+    64, 0, 0, 32, 0, 0, 150, 1212, 336, 127, 1216, 624, 64, 0, 0, 150, 1102, -6,
+    127, 1106, 282, 145, 206, 330, 32, 0, 0, 148, 1216, 0, 145, 79, -41, 64, 0, 0,
+    148, 1075, 0, 36, 0, 0, 148, 1182, 0, 68, 0, 0, 148, 1163, 0, 36, 0, 0,
+    149, 1182, 373, 68, 0, 0, 149, 1165, 0, 127, 1182, 373, 36, 0, 0, 137, 151, 0,
+    68, 0, 0, 36, 0, 0, 126, 1212, 373, 125, 1576, 580, 126, 1164, 0, 125, 1528, 207,
+    68, 0, 0, 36, 0, 0, 124, 1488, 580, 126, 1194, 373, 124, 1458, 208, 126, 1164, 1,
+    68, 0, 0, 36, 0, 0, 149, 1534, 480, 126, 1194, 373, 68, 0, 0, 149, 1504, 107,
+    126, 1164, 0, 36, 0, 0, 126, 1190, 373, 127, 1194, 652, 126, 1165, 0, 127, 1169, 279,
+    68, 0, 0, 36, 0, 0, 126, 1182, 373, 148, 1182, 0, 148, 1163, 0, 68, 0, 0,
+    148, 1163, 0, 136, 139, 0, 40, 0, 0, 149, 803, 373, 140, 0, 0, 149, 781, 1,
+    40, 0, 0, 148, 814, 0, 72, 0, 0, 148, 797, 0, 46, 0, 0, 148, 1319, 0,
+    78, 0, 0, 148, 1139, 0, 46, 0, 0, 149, 1319, 373, 78, 0, 0, 149, 1149, 0,
+    46, 0, 0, 126, 1320, 373, 125, 1684, 580, 126, 1138, 0, 125, 1502, 207, 78, 0, 0,
+    46, 0, 0, 124, 1612, 580, 126, 1318, 373, 124, 1431, 208, 126, 1137, 1, 78, 0, 0,
+    46, 0, 0, 149, 1658, 480, 126, 1318, 373, 149, 1478, 107, 126, 1138, 0, 78, 0, 0,
+    46, 0, 0, 126, 1313, 373, 127, 1317, 652, 126, 1138, 0, 127, 1142, 279, 78, 0, 0,
+    46, 0, 0, 126, 1319, 373, 148, 1319, 0, 148, 1139, 0, 78, 0, 0, 148, 1139, 0,
+    136, 115, 0, 125, 1319, 373, 46, -12, 0, 147, 1442, 308, 113, 115, 0, 147, 1112, 11,
+    78, 5, 0, 124, 1319, 373, 46, -12, 0, 147, 1442, 308, 63, 115, 0, 147, 1112, 11,
+    78, 5, 0, 46, -12, 0, 147, 1442, 308, 149, 1319, 373, 147, 1112, 11, 78, 5, 0,
+    149, 1149, 0, 127, 1319, 373, 46, -12, 0, 147, 1442, 308, 137, 115, 0, 147, 1112, 11,
+    78, 5, 0, 46, -12, 0, 147, 1442, 308, 148, 1319, 0, 147, 1112, 11, 78, 5, 0,
+    148, 1139, 0, 52, 0, 0, 148, 1269, 0, 84, 0, 0, 148, 1147, 0, 52, 0, 0,
+    149, 1262, 373, 84, 0, 0, 149, 1149, 0, 125, 1262, 373, 52, -5, 20, 147, 1508, 308,
+    113, 123, 0, 147, 1262, 11, 84, 2, 0, 124, 1262, 373, 52, -5, 20, 147, 1508, 308,
+    63, 123, 0, 147, 1262, 11, 84, 2, 0, 52, -5, 20, 147, 1508, 308, 149, 1262, 373,
+    147, 1262, 11, 84, 2, 0, 149, 1149, 0, 127, 1262, 373, 52, -5, 20, 147, 1508, 308,
+    137, 128, 0, 147, 1262, 11, 84, 2, 0, 52, -5, 20, 147, 1508, 308, 148, 1269, 0,
+    147, 1262, 11, 84, 2, 0, 148, 1147, 0, 56, 0, 0, 124, 1138, 380, 88, 0, 0,
+    63, 33, 5, 148, 1142, 0, 56, 0, 0, 148, 1396, 0, 88, 0, 0, 56, 0, 0,
+    149, 1138, 380, 88, 0, 0, 149, 1120, 7, 127, 1138, 373, 56, 0, 0, 137, 119, 0,
+    88, 0, 0, 151, 0, 0, 152, 0, 0, 153, 0, 0, 154, 0, 0, 155, 0, 0,
+    156, 0, 0, 157, 0, 0, 158, 0, 0, 159, 0, 0, 160, 0, 0,
+};
+
+// per outline: first contour, contour count
+inline constexpr uint16_t outlines[] = {
+    0, 2, 2, 2, 4, 2, 6, 3, 9, 5, 14, 2, 16, 1, 17, 1,
+    18, 1, 19, 1, 20, 1, 21, 1, 22, 1, 23, 1, 24, 1, 25, 2,
+    27, 1, 28, 1, 29, 1, 30, 2, 32, 1, 33, 2, 35, 1, 36, 3,
+    39, 2, 41, 2, 43, 2, 45, 1, 46, 2, 48, 1, 49, 2, 51, 2,
+    53, 2, 55, 3, 58, 1, 59, 2, 61, 1, 62, 1, 63, 1, 64, 1,
+    65, 1, 66, 1, 67, 1, 68, 1, 69, 1, 70, 1, 71, 2, 73, 2,
+    75, 2, 77, 2, 79, 1, 80, 1, 81, 1, 82, 1, 83, 1, 84, 1,
+    85, 1, 86, 1, 87, 1, 88, 1, 89, 1, 90, 1, 91, 1, 92, 1,
+    93, 2, 95, 2, 97, 1, 98, 2, 100, 2, 102, 1, 103, 2, 105, 1,
+    106, 2, 108, 2, 110, 1, 111, 1, 112, 1, 113, 1, 114, 2, 116, 2,
+    118, 2, 120, 1, 121, 1, 122, 1, 123, 2, 125, 1, 126, 1, 127, 1,
+    128, 1, 129, 1, 130, 1, 131, 1, 132, 1, 133, 1, 134, 2, 136, 2,
+    138, 1, 139, 2, 141, 1, 142, 2, 144, 2, 146, 2, 148, 3, 151, 3,
+    154, 2, 156, 1, 157, 1, 158, 4, 162, 1, 163, 2, 165, 2, 167, 1,
+    168, 1, 169, 1, 170, 1, 171, 1, 172, 1, 173, 1, 174, 1, 175, 3,
+    178, 2, 180, 2, 182, 1, 183, 2, 185, 1, 186, 1, 187, 1, 188, 1,
+    189, 2, 191, 3, 194, 2, 196, 2, 198, 1, 199, 3, 202, 2, 204, 1,
+    205, 1, 206, 1, 207, 2, 209, 3, 212, 2, 214, 2, 216, 3, 219, 3,
+    222, 2, 224, 1, 225, 2, 227, 1, 228, 1, 229, 1, 230, 1, 231, 1,
+    232, 1, 233, 1, 234, 1, 235, 2, 237, 2, 239, 1, 240, 3, 243, 1,
+    244, 3,
+};
+
+// per contour: end (exclusive) in points
+inline constexpr uint16_t contourEnds[] = {
+    4, 10, 14, 18, 22, 50, 84, 91, 98, 110, 122, 134, 138, 150, 160, 199,
+    203, 217, 231, 249, 261, 267, 271, 275, 279, 291, 303, 314, 343, 384, 387, 398,
+    428, 440, 465, 472, 484, 508, 520, 545, 557, 561, 565, 569, 575, 582, 586, 590,
+    597, 601, 634, 646, 711, 714, 722, 731, 740, 755, 781, 790, 799, 811, 821, 851,
+    863, 867, 879, 890, 896, 909, 919, 931, 943, 952, 963, 975, 993, 1013, 1022, 1062,
+    1070, 1088, 1095, 1108, 1120, 1129, 1139, 1147, 1151, 1159, 1166, 1170, 1174, 1185, 1212, 1224,
+    1241, 1267, 1284, 1296, 1317, 1324, 1344, 1356, 1385, 1405, 1409, 1413, 1425, 1429, 1440, 1444,
+    1479, 1499, 1511, 1523, 1540, 1552, 1564, 1581, 1599, 1639, 1659, 1679, 1680, 1687, 1700, 1712,
+    1728, 1738, 1775, 1779, 1816, 1846, 1850, 1856, 1863, 1890, 1918, 1954, 1966, 1991, 1995, 1999,
+    2011, 2062, 2066, 2070, 2094, 2118, 2144, 2148, 2175, 2186, 2193, 2200, 2206, 2210, 2234, 2258,
+    2267, 2287, 2291, 2303, 2318, 2330, 2334, 2359, 2400, 2404, 2437, 2451, 2455, 2475, 2486, 2490,
+    2502, 2514, 2521, 2528, 2531, 2542, 2546, 2579, 2583, 2587, 2591, 2598, 2628, 2632, 2636, 2648,
+    2651, 2670, 2686, 2690, 2703, 2716, 2728, 2738, 2748, 2772, 2785, 2794, 2842, 2849, 2877, 2889,
+    2901, 2908, 2953, 2964, 2968, 2969, 2984, 3010, 3014, 3018, 3022, 3032, 3042, 3066, 3083, 3095,
+    3109, 3134, 3146, 3166, 3170, 3196, 3210, 3214, 3218, 3224, 3230, 3236, 3242, 3248, 3254, 3266,
+    3270, 3274, 3278, 3328, 3332, 3336, 3371,
+};
+
+// per point: x * 2 + onCurve, y
+inline constexpr int16_t points[] = {
+    619, 254, 1025, 254, 1025, 0, 619, 0, 619, 1493, 1025, 1493, 1025, 838, 985, 481,
+    661, 481, 619, 838, 735, 1493, 735, 938, 395, 938, 395, 1493, 1491, 1493, 1491, 938,
+    1151, 938, 1151, 1493, 2095, 901, 1513, 901, 1345, 567, 1931, 567, 1795, 1470, 1587, 1055,
+    2171, 1055, 2381, 1470, 2701, 1470, 2495, 1055, 3119, 1055, 3119, 901, 2417, 901, 2253, 567,
+    2889, 567, 2889, 414, 2175, 414, 1967, 0, 1647, 0, 1853, 414, 1267, 414, 1061, 0,
+    739, 0, 947, 414, 317, 414, 317, 567, 1021, 567, 1189, 901, 545, 901, 545, 1055,
+    1267, 1055, 1471, 1470, 1385, -301, 1185, -301, 1183, 0, 972, 2, 552, 47, 341, 92,
+    341, 272, 544, 208, 962, 143, 1185, 142, 1185, 598, 742, 634, 340, 806, 341, 956,
+    340, 1119, 776, 1307, 1185, 1321, 1185, 1556, 1385, 1556, 1385, 1324, 1570, 1320, 1918, 1289,
+    2085, 1262, 2085, 1087, 1918, 1129, 1568, 1175, 1385, 1179, 1385, 752, 1838, 717, 2266, 537,
+    2267, 381, 2266, 212, 1812, 17, 1385, 2, 1185, 770, 1185, 1180, 952, 1167, 708, 1061,
+    709, 973, 708, 887, 934, 791, 1385, 578, 1385, 145, 1638, 162, 1896, 272, 1897, 362,
+    1896, 450, 1650, 554, 2979, 657, 2804, 657, 2606, 509, 2607, 377, 2606, 247, 2804, 98,
+    2979, 98, 3148, 98, 3346, 247, 3347, 377, 3346, 508, 3148, 657, 2979, 784, 3294, 784,
+    3666, 564, 3667, 377, 3666, 190, 3292, -29, 2979, -29, 2658, -29, 2286, 190, 2287, 377,
+    2286, 565, 2660, 784, 915, 1393, 742, 1393, 544, 1244, 545, 1114, 544, 982, 740, 834,
+    915, 834, 1088, 834, 1286, 982, 1287, 1114, 1286, 1243, 1086, 1393, 2721, 1520, 3041, 1520,
+    1173, -29, 853, -29, 915, 1520, 1230, 1520, 1606, 1301, 1607, 1114, 1606, 925, 1232, 707,
+    915, 707, 596, 707, 226, 926, 227, 1114, 226, 1300, 598, 1520, 997, 803, 814, 722,
+    644, 561, 645, 473, 644, 327, 1068, 133, 1389, 133, 1578, 133, 1910, 196, 2057, 260,
+    1279, 915, 2295, 395, 2412, 484, 2544, 687, 2557, 801, 2929, 801, 2904, 669, 2696, 411,
+    2511, 285, 3069, 0, 2565, 0, 2279, 147, 2070, 58, 1614, -29, 1353, -29, 870, -29,
+    258, 246, 259, 461, 258, 589, 526, 814, 795, 913, 698, 976, 598, 1101, 599, 1161,
+    598, 1323, 1042, 1520, 1411, 1520, 1576, 1520, 1906, 1484, 2077, 1448, 2077, 1266, 1902, 1313,
+    1586, 1362, 1451, 1362, 1240, 1362, 978, 1251, 979, 1163, 978, 1112, 1096, 1009, 735, 1493,
+    735, 938, 395, 938, 395, 1493, 1271, 1554, 1002, 1324, 742, 874, 743, 643, 742, 412,
+    1004, -41, 1271, -270, 951, -270, 650, -35, 352, 419, 353, 643, 352, 866, 648, 1318,
+    951, 1554, 329, 1554, 649, 1554, 948, 1318, 1246, 866, 1247, 643, 1246, 419, 948, -35,
+    649, -270, 329, -270, 594, -41, 856, 412, 857, 643, 856, 874, 594, 1324, 1927, 1247,
+    1209, 1053, 1927, 858, 1811, 760, 1139, 963, 1139, 586, 911, 586, 911, 963, 239, 760,
+    123, 858, 841, 1053, 123, 1247, 239, 1346, 911, 1143, 911, 1520, 1139, 1520, 1139, 1143,
+    1811, 1346, 1885, 1284, 1885, 727, 2999, 727, 2999, 557, 1885, 557, 1885, 0, 1549, 0,
+    1549, 557, 435, 557, 435, 727, 1549, 727, 1549, 1284, 481, 254, 903, 254, 903, 82,
+    575, -238, 317, -238, 481, 82, 201, 643, 1279, 643, 1279, 479, 201, 479, 439, 254,
+    861, 254, 861, 0, 439, 0, 1041, 1493, 1381, 1493, 341, -190, 1, -190, 1303, 1360,
+    990, 1360, 676, 1053, 677, 745, 676, 438, 990, 131, 1303, 131, 1616, 131, 1930, 438,
+    1931, 745, 1930, 1053, 1616, 1360, 1303, 1520, 1804, 1520, 2334, 1123, 2335, 745, 2334, 368,
+    1804, -29, 1303, -29, 800, -29, 270, 368, 271, 745, 270, 1123, 800, 1520, 509, 170,
+    1169, 170, 1169, 1309, 451, 1237, 451, 1421, 1165, 1493, 1569, 1493, 1569, 170, 2229, 170,
+    2229, 0, 509, 0, 787, 170, 2197, 170, 2197, 0, 301, 0, 301, 170, 530, 289,
+    1324, 690, 1427, 748, 1620, 857, 1774, 1008, 1775, 1081, 1774, 1200, 1440, 1350, 1173, 1350,
+    982, 1350, 560, 1284, 321, 1217, 321, 1421, 564, 1470, 988, 1520, 1165, 1520, 1628, 1520,
+    2180, 1288, 2181, 1094, 2180, 1002, 2042, 837, 1861, 725, 1810, 696, 1274, 419, 1663, 805,
+    1952, 774, 2278, 578, 2279, 434, 2278, 213, 1670, -29, 1111, -29, 922, -29, 524, 8,
+    313, 45, 313, 240, 480, 191, 880, 141, 1099, 141, 1478, 141, 1876, 291, 1877, 434,
+    1876, 566, 1506, 715, 1177, 715, 829, 715, 829, 881, 1193, 881, 1490, 881, 1806, 1000,
+    1807, 1112, 1806, 1227, 1480, 1350, 1177, 1350, 1010, 1350, 630, 1314, 403, 1276, 403, 1456,
+    632, 1488, 1034, 1520, 1213, 1520, 1672, 1520, 2208, 1311, 2209, 1133, 2208, 1009, 1924, 838,
+    1549, 1317, 529, 520, 1549, 520, 1443, 1493, 1951, 1493, 1951, 520, 2377, 520, 2377, 352,
+    1951, 352, 1951, 0, 1549, 0, 1549, 352, 201, 352, 201, 547, 443, 1493, 2029, 1493,
+    2029, 1323, 813, 1323, 813, 957, 900, 972, 1076, 987, 1165, 987, 1664, 987, 2248, 713,
+    2249, 479, 2248, 238, 1648, -29, 1103, -29, 914, -29, 524, 3, 317, 35, 317, 238,
+    496, 189, 880, 141, 1095, 141, 1440, 141, 1844, 323, 1845, 479, 1844, 635, 1440, 817,
+    1095, 817, 932, 817, 610, 781, 443, 743, 1353, 827, 1080, 827, 762, 641, 763, 479,
+    762, 318, 1080, 131, 1353, 131, 1624, 131, 1942, 318, 1943, 479, 1942, 641, 1624, 827,
+    2155, 1460, 2155, 1276, 2002, 1312, 1692, 1350, 1541, 1350, 1140, 1350, 718, 1080, 689, 807,
+    806, 894, 1162, 987, 1377, 987, 1826, 987, 2348, 714, 2349, 479, 2348, 249, 1804, -29,
+    1353, -29, 834, -29, 286, 368, 287, 745, 286, 1099, 958, 1520, 1525, 1520, 1676, 1520,
+    1986, 1490, 337, 1493, 2257, 1493, 2257, 1407, 1173, 0, 751, 0, 1771, 1323, 337, 1323,
+    1303, 709, 1014, 709, 684, 555, 685, 420, 684, 285, 1014, 131, 1303, 131, 1590, 131,
+    1922, 286, 1923, 420, 1922, 555, 1592, 709, 899, 795, 638, 827, 348, 1005, 349, 1133,
+    348, 1312, 858, 1520, 1303, 1520, 1748, 1520, 2256, 1312, 2257, 1133, 2256, 1005, 1966, 827,
+    1709, 795, 2000, 761, 2326, 563, 2327, 420, 2326, 203, 1796, -29, 1303, -29, 808, -29,
+    278, 203, 279, 420, 278, 563, 606, 761, 751, 1114, 750, 998, 1040, 868, 1303, 868,
+    1562, 868, 1856, 998, 1857, 1114, 1856, 1230, 1562, 1360, 1303, 1360, 1040, 1360, 750, 1230,
+    451, 31, 451, 215, 602, 179, 914, 141, 1065, 141, 1464, 141, 1886, 410, 1917, 684,
+    1800, 598, 1444, 506, 1229, 506, 780, 506, 258, 777, 259, 1012, 258, 1242, 802, 1520,
+    1255, 1520, 1772, 1520, 2318, 1123, 2319, 745, 2318, 392, 1648, -29, 1083, -29, 930, -29,
+    618, 1, 1255, 664, 1526, 664, 1844, 850, 1845, 1012, 1844, 1173, 1526, 1360, 1255, 1360,
+    982, 1360, 664, 1173, 665, 1012, 664, 850, 982, 664, 481, 254, 903, 254, 903, 0,
+    481, 0, 481, 1059, 903, 1059, 903, 805, 481, 805, 481, 1059, 903, 1059, 903, 805,
+    481, 805, 481, 254, 903, 254, 903, 82, 575, -238, 317, -238, 481, 82, 2999, 1008,
+    935, 641, 2999, 276, 2999, 94, 435, 559, 435, 725, 2999, 1190, 435, 930, 2999, 930,
+    2999, 762, 435, 762, 435, 522, 2999, 522, 2999, 352, 435, 352, 435, 1008, 435, 1190,
+    2999, 725, 2999, 559, 435, 94, 435, 276, 2495, 641, 783, 254, 1189, 254, 1189, 0,
+    783, 0, 1177, 401, 795, 401, 795, 555, 794, 656, 906, 786, 1087, 872, 1267, 961,
+    1380, 1014, 1482, 1108, 1483, 1157, 1482, 1246, 1220, 1356, 1005, 1356, 846, 1356, 488, 1286,
+    295, 1219, 295, 1407, 482, 1464, 868, 1520, 1075, 1520, 1442, 1520, 1888, 1326, 1889, 1167,
+    1888, 1091, 1744, 954, 1565, 868, 1389, 782, 1294, 735, 1216, 682, 1201, 657, 1188, 636,
+    1176, 576, 1177, 524, 1525, 537, 1524, 394, 1808, 231, 2057, 231, 2302, 231, 2584, 395,
+    2585, 537, 2584, 677, 2296, 842, 2053, 842, 1810, 842, 1524, 678, 2615, 238, 2494, 161,
+    2184, 88, 1979, 88, 1634, 88, 1204, 337, 1205, 537, 1204, 737, 1636, 987, 1979, 987,
+    2184, 987, 2496, 912, 2615, 836, 2615, 967, 2901, 967, 2901, 231, 3192, 253, 3522, 476,
+    3523, 653, 3522, 760, 3396, 948, 3269, 1028, 3060, 1159, 2462, 1298, 2111, 1298, 1864, 1298,
+    1412, 1233, 1221, 1169, 906, 1067, 552, 736, 553, 543, 552, 384, 782, 106, 1001, 0,
+    1210, -104, 1762, -213, 2077, -213, 2334, -213, 2832, -126, 3041, -45, 3221, -156, 2970, -253,
+    2380, -356, 2077, -356, 1706, -356, 1050, -225, 795, -100, 538, 25, 270, 354, 271, 543,
+    270, 725, 542, 1055, 795, 1180, 1052, 1307, 1728, 1442, 2107, 1442, 2530, 1442, 3256, 1268,
+    3503, 1108, 3652, 1010, 3810, 780, 3811, 657, 3810, 394, 3174, 90, 2615, 84, 1401, 1294,
+    853, 551, 1951, 551, 1173, 1493, 1631, 1493, 2769, 0, 2349, 0, 2077, 383, 731, 383,
+    459, 0, 33, 0, 807, 713, 807, 166, 1455, 166, 1780, 166, 2094, 301, 2095, 440,
+    2094, 580, 1780, 713, 1455, 713, 807, 1327, 807, 877, 1405, 877, 1700, 877, 1990, 988,
+    1991, 1102, 1990, 1215, 1700, 1327, 1405, 1327, 403, 1493, 1435, 1493, 1896, 1493, 2396, 1301,
+    2397, 1124, 2396, 987, 2140, 825, 1893, 805, 2190, 773, 2520, 570, 2521, 418, 2520, 218,
+    1976, 0, 1475, 0, 403, 0, 2639, 1378, 2639, 1165, 2434, 1260, 1972, 1354, 1713, 1354,
+    1200, 1354, 656, 1041, 657, 745, 656, 450, 1200, 137, 1713, 137, 1972, 137, 2434, 231,
+    2639, 326, 2639, 115, 2426, 43, 1952, -29, 1689, -29, 1010, -29, 230, 386, 231, 745,
+    230, 1105, 1010, 1520, 1689, 1520, 1956, 1520, 2430, 1449, 807, 1327, 807, 166, 1295, 166,
+    1912, 166, 2486, 446, 2487, 748, 2486, 1048, 1912, 1327, 1295, 1327, 403, 1493, 1233, 1493,
+    2100, 1493, 2912, 1132, 2913, 748, 2912, 362, 2096, 0, 1233, 0, 403, 0, 403, 1493,
+    2291, 1493, 2291, 1323, 807, 1323, 807, 881, 2229, 881, 2229, 711, 807, 711, 807, 170,
+    2327, 170, 2327, 0, 403, 0, 403, 1493, 2119, 1493, 2119, 1323, 807, 1323, 807, 883,
+    1991, 883, 1991, 713, 807, 713, 807, 0, 403, 0, 2439, 213, 2439, 614, 1779, 614,
+    1779, 780, 2839, 780, 2839, 139, 2604, 56, 2040, -29, 1721, -29, 1020, -29, 230, 380,
+    231, 745, 230, 1111, 1020, 1520, 1721, 1520, 2012, 1520, 2538, 1448, 2761, 1378, 2761, 1163,
+    2536, 1258, 2032, 1354, 1755, 1354, 1206, 1354, 656, 1048, 657, 745, 656, 443, 1206, 137,
+    1755, 137, 1968, 137, 2304, 174, 403, 1493, 807, 1493, 807, 881, 2275, 881, 2275, 1493,
+    2679, 1493, 2679, 0, 2275, 0, 2275, 711, 807, 711, 807, 0, 403, 0, 403, 1493,
+    807, 1493, 807, 0, 403, 0, 403, 1493, 807, 1493, 807, 104, 806, -166, 396, -410,
+    -57, -410, -211, -410, -211, -240, -85, -240, 182, -240, 402, -90, 403, 104, 403, 1493,
+    807, 1493, 807, 862, 2147, 1493, 2667, 1493, 1185, 797, 2773, 0, 2241, 0, 807, 719,
+    807, 0, 403, 0, 403, 1493, 807, 1493, 807, 170, 2261, 170, 2261, 0, 403, 0,
+    403, 1493, 1005, 1493, 1767, 477, 2533, 1493, 3135, 1493, 3135, 0, 2741, 0, 2741, 1311,
+    1971, 287, 1565, 287, 795, 1311, 795, 0, 403, 0, 403, 1493, 947, 1493, 2271, 244,
+    2271, 1493, 2663, 1493, 2663, 0, 2119, 0, 795, 1249, 795, 0, 403, 0, 1615, 1356,
+    1174, 1356, 656, 1028, 657, 745, 656, 463, 1174, 135, 1615, 135, 2054, 135, 2568, 463,
+    2569, 745, 2568, 1028, 2054, 1356, 1615, 1520, 2242, 1520, 2994, 1099, 2995, 745, 2994, 392,
+    2242, -29, 1615, -29, 984, -29, 230, 391, 231, 745, 230, 1099, 984, 1520, 807, 1327,
+    807, 766, 1315, 766, 1596, 766, 1904, 912, 1905, 1047, 1904, 1181, 1596, 1327, 1315, 1327,
+    403, 1493, 1315, 1493, 1816, 1493, 2330, 1266, 2331, 1047, 2330, 826, 1816, 600, 1315, 600,
+    807, 600, 807, 0, 403, 0, 1615, 1356, 1174, 1356, 656, 1028, 657, 745, 656, 463,
+    1174, 135, 1615, 135, 2054, 135, 2568, 463, 2569, 745, 2568, 1028, 2054, 1356, 2181, 27,
+    2713, -264, 2225, -264, 1783, -25, 1716, -27, 1646, -29, 1615, -29, 984, -29, 230, 392,
+    231, 745, 230, 1099, 984, 1520, 1615, 1520, 2242, 1520, 2994, 1099, 2995, 745, 2994, 485,
+    2576, 115, 1819, 700, 1948, 678, 2194, 534, 2319, 408, 2729, 0, 2295, 0, 1913, 383,
+    1764, 533, 1486, 631, 1247, 631, 807, 631, 807, 0, 403, 0, 403, 1493, 1315, 1493,
+    1826, 1493, 2330, 1279, 2331, 1063, 2330, 922, 2068, 736, 807, 1327, 807, 797, 1315, 797,
+    1606, 797, 1904, 932, 1905, 1063, 1904, 1194, 1606, 1327, 1315, 1327, 2193, 1444, 2193, 1247,
+    1962, 1302, 1554, 1356, 1365, 1356, 1034, 1356, 676, 1228, 677, 1110, 676, 1011, 914, 910,
+    1247, 879, 1491, 854, 1942, 811, 2372, 594, 2373, 412, 2372, 195, 1790, -29, 1229, -29,
+    1016, -29, 538, 19, 283, 66, 283, 274, 528, 205, 1000, 135, 1229, 135, 1574, 135,
+    1950, 271, 1951, 397, 1950, 507, 1680, 631, 1373, 662, 1127, 686, 674, 731, 270, 923,
+    271, 1094, 270, 1292, 828, 1520, 1319, 1520, 1528, 1520, 1964, 1482, -11, 1493, 2515, 1493,
+    2515, 1323, 1455, 1323, 1455, 0, 1049, 0, 1049, 1323, -11, 1323, 357, 1493, 763, 1493,
+    763, 586, 762, 346, 1110, 135, 1501, 135, 1888, 135, 2236, 346, 2237, 586, 2237, 1493,
+    2643, 1493, 2643, 561, 2642, 269, 2064, -29, 1501, -29, 934, -29, 356, 269, 357, 561,
+    1173, 0, 33, 1493, 455, 1493, 1401, 236, 2349, 1493, 2769, 1493, 1631, 0, 137, 1493,
+    545, 1493, 1173, 231, 1799, 1493, 2253, 1493, 2881, 231, 3507, 1493, 3917, 1493, 3167, 0,
+    2659, 0, 2029, 1296, 1393, 0, 885, 0, 259, 1493, 693, 1493, 1435, 938, 2181, 1493,
+    2615, 1493, 1655, 776, 2679, 0, 2245, 0, 1405, 635, 559, 0, 123, 0, 1189, 797,
+    -7, 1493, 427, 1493, 1255, 879, 2077, 1493, 2511, 1493, 1455, 711, 1455, 0, 1049, 0,
+    1049, 711, 231, 1493, 2577, 1493, 2577, 1339, 689, 170, 2623, 170, 2623, 0, 185, 0,
+    185, 154, 2073, 1323, 231, 1323, 353, 1556, 1201, 1556, 1201, 1413, 721, 1413, 721, -127,
+    1201, -127, 1201, -270, 353, -270, 341, 1493, 1381, -190, 1041, -190, 1, 1493, 1247, 1556,
+    1247, -270, 399, -270, 399, -127, 877, -127, 877, 1413, 399, 1413, 399, 1556, 1913, 1493,
+    2999, 936, 2597, 936, 1717, 1331, 837, 936, 435, 936, 1521, 1493, 2089, -340, 2089, -483,
+    -39, -483, -39, -340, 735, 1638, 1299, 1264, 993, 1264, 341, 1638, 1405, 563, 958, 563,
+    614, 461, 615, 338, 614, 240, 872, 125, 1095, 125, 1400, 125, 1770, 342, 1771, 522,
+    1771, 563, 2139, 639, 2139, 0, 1771, 0, 1771, 170, 1644, 68, 1268, -29, 997, -29,
+    652, -29, 246, 164, 247, 326, 246, 515, 752, 707, 1255, 707, 1771, 707, 1771, 725,
+    1770, 852, 1436, 991, 1135, 991, 942, 991, 578, 945, 411, 899, 411, 1069, 612, 1108,
+    992, 1147, 1173, 1147, 1658, 1147, 2138, 895, 1995, 559, 1994, 762, 1660, 993, 1369, 993,
+    1076, 993, 742, 762, 743, 559, 742, 356, 1076, 125, 1369, 125, 1660, 125, 1994, 356,
+    743, 950, 858, 1050, 1212, 1147, 1459, 1147, 1866, 1147, 2376, 823, 2377, 559, 2376, 295,
+    1866, -29, 1459, -29, 1212, -29, 858, 68, 743, 168, 743, 0, 373, 0, 373, 1556,
+    743, 1556, 1999, 1077, 1999, 905, 1842, 948, 1528, 991, 1369, 991, 1010, 991, 614, 764,
+    615, 559, 614, 354, 1010, 127, 1369, 127, 1528, 127, 1842, 170, 1999, 213, 1999, 43,
+    1844, 7, 1514, -29, 1329, -29, 822, -29, 226, 289, 227, 559, 226, 833, 828, 1147,
+    1353, 1147, 1522, 1147, 1846, 1112, 1861, 950, 1861, 1556, 2229, 1556, 2229, 0, 1861, 0,
+    1861, 168, 1744, 68, 1390, -29, 1143, -29, 736, -29, 226, 295, 227, 559, 226, 823,
+    736, 1147, 1143, 1147, 1390, 1147, 1744, 1050, 607, 559, 606, 356, 940, 125, 1233, 125,
+    1524, 125, 1860, 356, 1861, 559, 1860, 762, 1524, 993, 1233, 993, 940, 993, 606, 762,
+    2303, 606, 2303, 516, 611, 516, 634, 326, 1044, 127, 1411, 127, 1622, 127, 2020, 179,
+    2217, 231, 2217, 57, 2018, 15, 1602, -29, 1389, -29, 852, -29, 226, 283, 227, 549,
+    226, 824, 820, 1147, 1325, 1147, 1776, 1147, 2302, 856, 1935, 660, 1930, 811, 1600, 991,
+    1329, 991, 1020, 991, 650, 817, 623, 659, 1521, 1556, 1521, 1403, 1169, 1403, 970, 1403,
+    816, 1323, 817, 1219, 817, 1120, 1423, 1120, 1423, 977, 817, 977, 817, 0, 447, 0,
+    447, 977, 95, 977, 95, 1120, 447, 1120, 447, 1198, 446, 1385, 794, 1556, 1173, 1556,
+    1861, 573, 1860, 773, 1530, 993, 1233, 993, 936, 993, 606, 773, 607, 573, 606, 374,
+    936, 154, 1233, 154, 1530, 154, 1860, 374, 2229, 139, 2228, -147, 1720, -426, 1197, -426,
+    1002, -426, 658, -397, 497, -367, 497, -188, 658, -232, 974, -274, 1139, -274, 1500, -274,
+    1860, -85, 1861, 106, 1861, 197, 1746, 98, 1390, 0, 1143, 0, 730, 0, 226, 314,
+    227, 573, 226, 833, 730, 1147, 1143, 1147, 1390, 1147, 1746, 1049, 1861, 950, 1861, 1120,
+    2229, 1120, 2249, 676, 2249, 0, 1881, 0, 1881, 670, 1880, 829, 1632, 987, 1385, 987,
+    1086, 987, 742, 797, 743, 633, 743, 0, 373, 0, 373, 1556, 743, 1556, 743, 946,
+    874, 1047, 1232, 1147, 1467, 1147, 1852, 1147, 2248, 908, 387, 1120, 755, 1120, 755, 0,
+    387, 0, 387, 1556, 755, 1556, 755, 1323, 387, 1323, 387, 1120, 755, 1120, 755, -20,
+    754, -234, 428, -426, 67, -426, -73, -426, -73, -270, 25, -270, 234, -270, 386, -173,
+    387, -20, 387, 1556, 755, 1556, 755, 1323, 387, 1323, 373, 1556, 743, 1556, 743, 637,
+    1841, 1120, 2311, 1120, 1123, 596, 2361, 0, 1881, 0, 743, 547, 743, 0, 373, 0,
+    387, 1556, 755, 1556, 755, 0, 387, 0, 2131, 905, 2268, 1029, 2652, 1147, 2913, 1147,
+    3262, 1147, 3642, 902, 3643, 676, 3643, 0, 3273, 0, 3273, 670, 3272, 831, 3044, 987,
+    2811, 987, 2524, 987, 2192, 797, 2193, 633, 2193, 0, 1823, 0, 1823, 670, 1822, 832,
+    1594, 987, 1357, 987, 1074, 987, 742, 796, 743, 633, 743, 0, 373, 0, 373, 1120,
+    743, 1120, 743, 946, 868, 1049, 1220, 1147, 1463, 1147, 1706, 1147, 2048, 1023, 2249, 676,
+    2249, 0, 1881, 0, 1881, 670, 1880, 829, 1632, 987, 1385, 987, 1086, 987, 742, 797,
+    743, 633, 743, 0, 373, 0, 373, 1120, 743, 1120, 743, 946, 874, 1047, 1232, 1147,
+    1467, 1147, 1852, 1147, 2248, 908, 1255, 991, 958, 991, 614, 760, 615, 559, 614, 358,
+    956, 127, 1255, 127, 1548, 127, 1892, 359, 1893, 559, 1892, 758, 1548, 991, 1255, 1147,
+    1734, 1147, 2282, 835, 2283, 559, 2282, 284, 1734, -29, 1255, -29, 772, -29, 226, 284,
+    227, 559, 226, 835, 772, 1147, 743, 168, 743, -426, 373, -426, 373, 1120, 743, 1120,
+    743, 950, 858, 1050, 1212, 1147, 1459, 1147, 1866, 1147, 2376, 823, 2377, 559, 2376, 295,
+    1866, -29, 1459, -29, 1212, -29, 858, 68, 1995, 559, 1994, 762, 1660, 993, 1369, 993,
+    1076, 993, 742, 762, 743, 559, 742, 356, 1076, 125, 1369, 125, 1660, 125, 1994, 356,
+    607, 559, 606, 356, 940, 125, 1233, 125, 1524, 125, 1860, 356, 1861, 559, 1860, 762,
+    1524, 993, 1233, 993, 940, 993, 606, 762, 1861, 168, 1744, 68, 1390, -29, 1143, -29,
+    736, -29, 226, 295, 227, 559, 226, 823, 736, 1147, 1143, 1147, 1390, 1147, 1744, 1050,
+    1861, 950, 1861, 1120, 2229, 1120, 2229, -426, 1861, -426, 1685, 948, 1622, 966, 1476, 983,
+    1389, 983, 1076, 983, 742, 780, 743, 590, 743, 0, 373, 0, 373, 1120, 743, 1120,
+    743, 946, 858, 1048, 1230, 1147, 1497, 1147, 1534, 1147, 1626, 1142, 1683, 1137, 1815, 1087,
+    1815, 913, 1658, 953, 1322, 993, 1143, 993, 868, 993, 594, 909, 595, 825, 594, 761,
+    790, 688, 1087, 655, 1213, 641, 1604, 599, 1934, 446, 1935, 309, 1934, 153, 1440, -29,
+    1009, -29, 828, -29, 438, 6, 223, 41, 223, 231, 426, 178, 822, 125, 1017, 125,
+    1276, 125, 1556, 214, 1557, 295, 1556, 370, 1354, 450, 1013, 487, 885, 502, 542, 538,
+    238, 687, 239, 817, 238, 975, 686, 1147, 1099, 1147, 1302, 1147, 1662, 1117, 751, 1438,
+    751, 1120, 1509, 1120, 1509, 977, 751, 977, 751, 369, 750, 232, 900, 154, 1131, 154,
+    1509, 154, 1509, 0, 1131, 0, 704, 0, 380, 159, 381, 369, 381, 977, 111, 977,
+    111, 1120, 381, 1120, 381, 1438, 349, 442, 349, 1120, 717, 1120, 717, 449, 716, 290,
+    964, 131, 1213, 131, 1510, 131, 1856, 321, 1857, 485, 1857, 1120, 2225, 1120, 2225, 0,
+    1857, 0, 1857, 172, 1722, 70, 1368, -29, 1135, -29, 748, -29, 348, 211, 1275, 1147,
+    123, 1120, 513, 1120, 1213, 180, 1913, 1120, 2303, 1120, 1463, 0, 963, 0, 173, 1120,
+    541, 1120, 1001, 246, 1459, 1120, 1893, 1120, 2353, 246, 2811, 1120, 3179, 1120, 2593, 0,
+    2159, 0, 1677, 918, 1193, 0, 759, 0, 2249, 1120, 1439, 575, 2291, 0, 1857, 0,
+    1205, 440, 553, 0, 119, 0, 989, 586, 193, 1120, 627, 1120, 1221, 721, 1815, 1120,
+    1319, -104, 1162, -304, 866, -426, 619, -426, 325, -426, 325, -272, 541, -272, 692, -272,
+    860, -200, 963, -66, 1029, 18, 123, 1120, 513, 1120, 1213, 244, 1913, 1120, 2303, 1120,
+    227, 1120, 1975, 1120, 1975, 952, 591, 147, 1975, 147, 1975, 0, 177, 0, 177, 168,
+    1561, 973, 227, 973, 2095, -190, 2095, -334, 1971, -334, 1472, -334, 1134, -186, 1135, 35,
+    1135, 274, 1134, 425, 918, 541, 635, 541, 513, 541, 513, 684, 635, 684, 920, 684,
+    1134, 799, 1135, 948, 1135, 1188, 1134, 1409, 1472, 1556, 1971, 1556, 2095, 1556, 2095, 1413,
+    1959, 1413, 1676, 1413, 1504, 1325, 1505, 1184, 1505, 936, 1504, 779, 1322, 637, 1103, 612,
+    1324, 585, 1504, 443, 1505, 287, 1505, 39, 1504, -102, 1676, -190, 1959, -190, 861, 1565,
+    861, -483, 521, -483, 521, 1565, 513, -190, 653, -190, 932, -190, 1102, -104, 1103, 39,
+    1103, 287, 1102, 443, 1282, 585, 1505, 612, 1282, 637, 1102, 779, 1103, 936, 1103, 1184,
+    1102, 1326, 932, 1413, 653, 1413, 513, 1413, 513, 1556, 639, 1556, 1136, 1556, 1470, 1409,
+    1471, 1188, 1471, 948, 1470, 799, 1686, 684, 1971, 684, 2095, 684, 2095, 541, 1971, 541,
+    1686, 541, 1470, 425, 1471, 274, 1471, 35, 1470, -186, 1136, -334, 639, -334, 513, -334,
+    2999, 817, 2999, 639, 2788, 560, 2430, 492, 2237, 492, 2016, 492, 1725, 551, 1702, 555,
+    1693, 557, 1678, 560, 1649, 565, 1338, 627, 1151, 627, 974, 627, 630, 550, 435, 467,
+    435, 645, 644, 724, 1002, 793, 1197, 793, 1416, 793, 1711, 733, 1730, 729, 1741, 727,
+    1756, 724, 1785, 719, 2094, 657, 2283, 657, 2454, 657, 2792, 733, 1025, 866, 619, 866,
+    619, 1120, 1025, 1120, 1025, -373, 619, -373, 619, 282, 661, 639, 985, 639, 1025, 282,
+    1357, 131, 1357, 987, 1062, 969, 734, 743, 735, 559, 734, 374, 1062, 148, 2119, 1077,
+    2119, 905, 1970, 946, 1698, 988, 1563, 991, 1561, 127, 1700, 132, 1974, 174, 2119, 213,
+    2119, 43, 1988, 13, 1714, -22, 1561, -29, 1561, -313, 1357, -313, 1357, -25, 874, -5,
+    344, 302, 345, 559, 344, 817, 874, 1123, 1357, 1145, 1357, 1432, 1561, 1432, 1563, 1145,
+    1708, 1141, 1982, 1108, 2205, 1460, 2205, 1278, 2052, 1319, 1780, 1360, 1659, 1360, 1362, 1360,
+    1130, 1205, 1131, 993, 1131, 778, 1913, 778, 1913, 635, 1131, 635, 1131, 170, 2245, 170,
+    2245, 0, 259, 0, 259, 170, 731, 170, 731, 635, 333, 635, 333, 778, 731, 778,
+    731, 1016, 730, 1277, 1158, 1520, 1623, 1520, 1744, 1520, 2046, 1489, 1783, 993, 2197, 1202,
+    2425, 1087, 2013, 881, 2086, 822, 2158, 703, 2159, 641, 2158, 578, 2082, 463, 2003, 406,
+    2421, 199, 2193, 86, 1779, 293, 1660, 253, 1428, 215, 1307, 215, 1190, 215, 950, 252,
+    829, 289, 415, 82, 189, 197, 603, 403, 528, 465, 454, 583, 455, 641, 454, 705,
+    530, 821, 607, 877, 193, 1083, 423, 1198, 837, 991, 946, 1030, 1178, 1067, 1307, 1067,
+    1426, 1067, 1660, 1031, 1845, 643, 1844, 755, 1534, 909, 1307, 909, 1082, 909, 766, 755,
+    767, 643, 766, 529, 1080, 373, 1307, 373, 1532, 373, 1844, 530, 2331, 455, 1505, 455,
+    1505, 0, 1103, 0, 1103, 455, 271, 455, 271, 578, 1103, 578, 1103, 629, 935, 784,
+    271, 784, 271, 907, 799, 907, 165, 1493, 545, 1493, 1303, 793, 2057, 1493, 2439, 1493,
+    1803, 907, 2331, 907, 2331, 784, 1669, 784, 1501, 629, 1501, 578, 2331, 578, 861, 408,
+    861, -350, 521, -350, 521, 408, 861, 1432, 861, 674, 521, 674, 521, 1432, 759, 936,
+    632, 890, 508, 800, 509, 754, 508, 678, 786, 545, 1287, 410, 1412, 455, 1536, 546,
+    1537, 592, 1536, 667, 1250, 803, 1659, 1462, 1659, 1298, 1492, 1337, 1206, 1376, 1095, 1376,
+    900, 1376, 684, 1296, 685, 1225, 684, 1135, 1097, 1020, 1148, 1005, 1177, 997, 1598, 878,
+    1860, 724, 1861, 623, 1860, 533, 1676, 393, 1491, 340, 1614, 288, 1728, 179, 1729, 115,
+    1728, -27, 1320, -195, 975, -195, 828, -195, 520, -166, 345, -137, 345, 27, 518, -12,
+    814, -51, 931, -51, 1134, -51, 1360, 33, 1361, 109, 1360, 211, 919, 334, 869, 348,
+    440, 468, 184, 621, 185, 723, 184, 814, 370, 957, 553, 1006, 434, 1050, 316, 1162,
+    317, 1231, 316, 1361, 716, 1520, 1049, 1520, 1194, 1520, 1500, 1491, 1213, 1552, 1619, 1552,
+    1619, 1350, 1213, 1350, 431, 1552, 837, 1552, 837, 1350, 431, 1350, 2049, 1485, 2352, 1485,
+    2878, 1375, 3097, 1266, 3314, 1157, 3530, 895, 3531, 741, 3530, 589, 3314, 328, 3097, 219,
+    2878, 110, 2352, 0, 2049, 0, 1744, 0, 1218, 110, 1001, 219, 782, 328, 566, 589,
+    567, 741, 566, 895, 782, 1157, 1001, 1266, 1218, 1375, 1744, 1485, 2049, 1382, 1786, 1382,
+    1334, 1288, 1147, 1194, 958, 1100, 766, 871, 767, 741, 766, 612, 958, 385, 1147, 291,
+    1334, 197, 1786, 102, 2049, 102, 2312, 102, 2766, 197, 2955, 291, 3140, 384, 3326, 610,
+    3327, 741, 3326, 874, 3138, 1101, 2955, 1194, 2766, 1288, 2312, 1382, 2647, 1137, 2647, 1008,
+    2514, 1041, 2254, 1073, 2123, 1073, 1824, 1073, 1490, 898, 1491, 741, 1490, 582, 1832, 408,
+    2143, 408, 2270, 408, 2514, 439, 2647, 473, 2647, 346, 2512, 317, 2238, 289, 2099, 289,
+    1666, 289, 1164, 533, 1165, 741, 1164, 950, 1666, 1192, 2099, 1192, 2244, 1192, 2516, 1164,
+    279, 592, 1655, 592, 1655, 469, 279, 469, 1651, 1165, 1651, 717, 1353, 717, 1353, 829,
+    1264, 766, 976, 698, 791, 698, 534, 698, 230, 833, 231, 946, 230, 1081, 612, 1219,
+    989, 1219, 1353, 1219, 1353, 1223, 1352, 1314, 1118, 1405, 885, 1405, 760, 1405, 488, 1371,
+    353, 1337, 353, 1464, 498, 1492, 788, 1520, 927, 1520, 1292, 1520, 1650, 1344, 1099, 1104,
+    776, 1104, 524, 1037, 525, 958, 524, 894, 720, 817, 885, 817, 1092, 817, 1352, 961,
+    1353, 1075, 1353, 1104, 2123, 1059, 2123, 868, 1521, 600, 2123, 332, 2123, 141, 1185, 559,
+    1185, 641, 1255, 1059, 1255, 868, 653, 600, 1255, 332, 1255, 141, 317, 559, 317, 641,
+    435, 862, 2999, 862, 2999, 287, 2663, 287, 2663, 692, 435, 692, 201, 643, 1279, 643,
+    1279, 479, 201, 479, 2049, 1382, 1786, 1382, 1334, 1288, 1147, 1194, 958, 1100, 766, 871,
+    767, 741, 766, 612, 958, 385, 1147, 291, 1334, 197, 1786, 102, 2049, 102, 2312, 102,
+    2766, 197, 2955, 291, 3140, 384, 3326, 610, 3327, 741, 3326, 874, 3138, 1101, 2955, 1194,
+    2766, 1288, 2312, 1382, 2049, 1485, 2352, 1485, 2878, 1375, 3097, 1266, 3314, 1157, 3530, 895,
+    3531, 741, 3530, 589, 3314, 328, 3097, 219, 2878, 110, 2352, 0, 2049, 0, 1744, 0,
+    1218, 110, 1001, 219, 782, 328, 566, 589, 567, 741, 566, 895, 782, 1157, 1001, 1266,
+    1218, 1375, 1744, 1485, 1995, 1071, 1749, 1071, 1749, 795, 1995, 795, 2214, 795, 2388, 857,
+    2389, 932, 2388, 1008, 2212, 1071, 2009, 1174, 2360, 1174, 2708, 1055, 2709, 934, 2708, 848,
+    2498, 736, 2307, 719, 2354, 711, 2488, 634, 2581, 561, 2855, 338, 2511, 338, 2253, 547,
+    2134, 643, 1988, 694, 1881, 694, 1749, 694, 1749, 338, 1439, 338, 1439, 1174, 427, 1526,
+    1623, 1526, 1623, 1378, 427, 1378, 1025, 1391, 864, 1391, 644, 1280, 645, 1200, 644, 1121,
+    864, 1012, 1025, 1012, 1184, 1012, 1404, 1121, 1405, 1200, 1404, 1279, 1182, 1391, 1025, 1520,
+    1152, 1520, 1388, 1471, 1475, 1425, 1566, 1380, 1658, 1266, 1659, 1200, 1658, 1068, 1288, 885,
+    1021, 885, 750, 885, 390, 1065, 391, 1200, 390, 1334, 758, 1520, 1885, 1284, 1885, 897,
+    2999, 897, 2999, 727, 1885, 727, 1885, 340, 1549, 340, 1549, 727, 435, 727, 435, 897,
+    1549, 897, 1549, 1284, 435, 170, 2999, 170, 2999, 0, 435, 0, 537, 782, 1385, 782,
+    1385, 668, 189, 668, 189, 778, 256, 809, 383, 865, 1070, 1170, 1071, 1264, 1070, 1330,
+    862, 1411, 693, 1411, 588, 1411, 344, 1376, 201, 1341, 201, 1464, 354, 1492, 620, 1520,
+    735, 1520, 1024, 1520, 1372, 1388, 1373, 1280, 1372, 1141, 711, 857, 598, 809, 1049, 1120,
+    1232, 1102, 1434, 993, 1435, 911, 1434, 787, 1054, 653, 701, 653, 586, 653, 336, 674,
+    197, 694, 197, 815, 300, 788, 538, 762, 673, 762, 890, 762, 1130, 841, 1131, 911,
+    1130, 985, 908, 1061, 693, 1061, 521, 1061, 521, 1169, 709, 1169, 896, 1169, 1090, 1232,
+    1091, 1292, 1090, 1350, 890, 1411, 701, 1411, 620, 1411, 416, 1393, 255, 1370, 255, 1485,
+    400, 1502, 656, 1520, 767, 1520, 1054, 1520, 1392, 1402, 1393, 1303, 1392, 1234, 1212, 1138,
+    1303, 1638, 1701, 1638, 1049, 1262, 743, 1262, 349, -426, 349, 1120, 717, 1120, 717, 424,
+    716, 279, 992, 131, 1263, 131, 1558, 131, 1856, 299, 1857, 467, 1857, 1120, 2225, 1120,
+    2225, 258, 2224, 198, 2294, 141, 2369, 141, 2386, 141, 2450, 152, 2507, 164, 2507, 16,
+    2424, -7, 2278, -29, 2209, -29, 2070, -29, 1906, 49, 1877, 129, 1776, 50, 1486, -29,
+    1291, -29, 1086, -29, 800, 49, 717, 127, 717, -426, 1267, 1493, 2163, 1493, 2163, -197,
+    1881, -197, 1881, 1370, 1501, 1370, 1501, -197, 1217, -197, 1217, 649, 786, 666, 316, 887,
+    317, 1071, 316, 1261, 836, 1493, 439, 838, 861, 838, 861, 584, 439, 584, 1193, 0,
+    1302, -62, 1410, -167, 1411, -215, 1410, -304, 1170, -395, 935, -395, 842, -395, 668, -383,
+    583, -371, 583, -240, 650, -257, 798, -272, 893, -272, 1010, -272, 1130, -224, 1131, -178,
+    1130, -148, 1044, -61, 955, 0, 313, 778, 721, 778, 721, 1389, 275, 1348, 275, 1464,
+    735, 1503, 1009, 1503, 1009, 778, 1419, 778, 1419, 668, 313, 668, 279, 592, 1655, 592,
+    1655, 469, 279, 469, 967, 1520, 1324, 1520, 1736, 1299, 1737, 1108, 1736, 917, 1324, 698,
+    967, 698, 608, 698, 192, 918, 193, 1108, 192, 1299, 608, 1520, 967, 1405, 756, 1405,
+    504, 1244, 505, 1108, 504, 975, 758, 815, 967, 815, 1176, 815, 1426, 975, 1427, 1108,
+    1426, 1245, 1178, 1405, 387, 1059, 1325, 641, 1325, 559, 387, 141, 387, 332, 989, 600,
+    387, 868, 1255, 1059, 2193, 641, 2193, 559, 1255, 141, 1255, 332, 1857, 600, 1255, 868,
+    955, 1382, 337, 963, 955, 963, 911, 1503, 1243, 1503, 1243, 963, 1513, 963, 1513, 854,
+    1243, 854, 1243, 668, 955, 668, 955, 854, 127, 854, 127, 975, 1115, 1520, 1435, 1520,
+    -429, -29, -749, -29, 1001, 719, 1381, 719, 1381, 563, 1380, 462, 1270, 332, 1091, 245,
+    911, 157, 794, 104, 692, 10, 693, -39, 692, -128, 954, -238, 1173, -238, 1328, -238,
+    1688, -168, 1881, -101, 1881, -289, 1692, -346, 1308, -402, 1103, -402, 734, -402, 286, -208,
+    287, -49, 286, 27, 432, 164, 611, 250, 787, 336, 882, 383, 958, 436, 975, 461,
+    988, 482, 1000, 542, 1001, 596, 1393, 866, 989, 866, 989, 1120, 1393, 1120, -1137, 1526,
+    -745, 1262, -1051, 1262, -1511, 1526, -913, 1526, -543, 1526, -999, 1262, -1305, 1262, -1211, 1528,
+    -835, 1528, -413, 1262, -691, 1262, -1023, 1440, -1355, 1262, -1633, 1262, -1031, 1337, -1145, 1370,
+    -1196, 1384, -1258, 1395, -1281, 1395, -1354, 1395, -1434, 1345, -1433, 1300, -1433, 1294, -1683, 1294,
+    -1684, 1395, -1478, 1513, -1305, 1513, -1234, 1513, -1112, 1497, -1015, 1470, -901, 1440, -856, 1427,
+    -788, 1415, -757, 1415, -694, 1415, -614, 1466, -613, 1507, -613, 1513, -363, 1513, -368, 1413,
+    -574, 1294, -741, 1294, -810, 1294, -928, 1310, -835, 1497, -429, 1497, -429, 1294, -835, 1294,
+    -1617, 1497, -1211, 1497, -1211, 1294, -1617, 1294, 1705, 1626, 1704, 1689, 1526, 1778, 1401, 1778,
+    1272, 1778, 1098, 1691, 1099, 1626, 1098, 1563, 1274, 1475, 1401, 1475, 1526, 1475, 1704, 1563,
+    1401, 1294, 857, 551, 1947, 551, 1099, 1397, 976, 1438, 852, 1553, 853, 1626, 852, 1741,
+    1170, 1901, 1401, 1901, 1628, 1901, 1950, 1740, 1951, 1626, 1950, 1556, 1824, 1438, 1705, 1397,
+    2769, 0, 2349, 0, 2077, 383, 731, 383, 459, 0, 33, 0, 3691, 1493, 3691, 1323,
+    2209, 1323, 2209, 881, 3631, 881, 3631, 711, 2209, 711, 2209, 170, 3729, 170, 3729, 0,
+    1803, 0, 1803, 383, 747, 383, 427, 0, 17, 0, 1267, 1493, 1545, 1335, 885, 551,
+    1803, 551, 1803, 1335, 423, 1493, 1255, 1493, 2120, 1493, 2932, 1132, 2933, 748, 2932, 362,
+    2118, 0, 1255, 0, 423, 0, 423, 700, 21, 700, 21, 844, 423, 844, 829, 1327,
+    829, 844, 1501, 844, 1501, 700, 829, 700, 829, 166, 1315, 166, 1932, 166, 2506, 446,
+    2507, 748, 2506, 1048, 1932, 1327, 1315, 1327, 2873, 1100, 1959, 641, 2873, 184, 2635, 63,
+    1717, 522, 799, 63, 563, 184, 1475, 641, 563, 1100, 799, 1221, 1717, 762, 2635, 1221,
+    2413, 1112, 979, 266, 1102, 202, 1424, 135, 1615, 135, 2054, 135, 2568, 463, 2569, 745,
+    2568, 857, 2490, 1041, 2249, 1225, 2126, 1289, 1804, 1356, 1615, 1356, 1174, 1356, 656, 1028,
+    657, 745, 656, 633, 734, 445, 813, 377, 545, 219, 388, 321, 230, 585, 231, 745,
+    230, 1099, 984, 1520, 1615, 1520, 1874, 1520, 2316, 1443, 2491, 1368, 2815, 1559, 3019, 1470,
+    2679, 1272, 2834, 1169, 2994, 903, 2995, 745, 2994, 392, 2242, -29, 1615, -29, 1358, -29,
+    916, 46, 735, 121, 411, -70, 205, 18, 403, 1493, 807, 1493, 807, 1229, 1315, 1229,
+    1816, 1229, 2330, 1004, 2331, 784, 2330, 564, 1816, 338, 1315, 338, 807, 338, 807, 0,
+    403, 0, 807, 1063, 807, 504, 1315, 504, 1596, 504, 1904, 650, 1905, 784, 1904, 918,
+    1598, 1063, 1315, 1063, 373, 1137, 372, 1337, 850, 1556, 1287, 1556, 1702, 1556, 2140, 1324,
+    2147, 1100, 1844, 1092, 1508, 977, 1509, 881, 1508, 834, 1624, 753, 1755, 711, 1869, 674,
+    2200, 568, 2392, 426, 2393, 326, 2392, 154, 1942, -29, 1521, -29, 1392, -29, 1120, -4,
+    975, 20, 975, 184, 1134, 154, 1414, 125, 1545, 125, 1776, 125, 2016, 220, 2017, 311,
+    2016, 374, 1898, 458, 1697, 520, 1513, 575, 1320, 634, 1146, 769, 1147, 860, 1146, 987,
+    1480, 1159, 1783, 1188, 1766, 1291, 1504, 1403, 1279, 1403, 1018, 1403, 746, 1264, 747, 1133,
+    747, 0, 373, 0, 877, 1638, 1173, 1638, 1663, 1262, 1385, 1262, 1025, 1507, 665, 1262,
+    387, 1262, 1017, 1370, 903, 1425, 858, 1445, 792, 1464, 767, 1464, 690, 1464, 618, 1391,
+    615, 1309, 365, 1309, 368, 1444, 572, 1591, 755, 1591, 830, 1591, 958, 1563, 1033, 1530,
+    1147, 1475, 1190, 1455, 1256, 1436, 1283, 1436, 1358, 1436, 1430, 1509, 1435, 1591, 1685, 1591,
+    1680, 1456, 1476, 1309, 1295, 1309, 1218, 1309, 1090, 1337, 1329, 1524, 1328, 1587, 1152, 1675,
+    1025, 1675, 894, 1675, 720, 1588, 721, 1524, 720, 1459, 894, 1372, 1025, 1372, 1152, 1372,
+    1328, 1460, 1573, 1524, 1572, 1409, 1254, 1249, 1025, 1249, 794, 1249, 476, 1409, 477, 1524,
+    476, 1639, 794, 1798, 1025, 1798, 1254, 1798, 1572, 1639, 3437, 660, 3434, 811, 3104, 991,
+    2831, 991, 2524, 991, 2154, 817, 2127, 659, 1991, 963, 2138, 1053, 2562, 1147, 2827, 1147,
+    3278, 1147, 3806, 856, 3807, 606, 3807, 516, 2115, 516, 2138, 325, 2546, 125, 2913, 125,
+    3120, 125, 3520, 178, 3721, 231, 3721, 57, 3520, 15, 3104, -29, 2893, -29, 2558, -29,
+    2062, 92, 1909, 211, 1762, 91, 1330, -29, 1045, -29, 666, -29, 246, 158, 247, 326,
+    246, 515, 752, 707, 1255, 707, 1771, 707, 1771, 725, 1770, 852, 1436, 991, 1135, 991,
+    942, 991, 578, 945, 411, 899, 411, 1069, 612, 1108, 992, 1147, 1173, 1147, 1456, 1147,
+    1882, 1051, 1405, 563, 958, 563, 614, 461, 615, 338, 614, 240, 872, 125, 1095, 125,
+    1400, 125, 1770, 342, 1771, 522, 1771, 563, 387, 1120, 755, 1120, 755, 0, 387, 0,
+    571, 1147, 1677, 915, 1576, 932, 1400, 948, 1319, 948, 984, 948, 614, 732, 615, 537,
+    614, 349, 962, 127, 1255, 127, 1544, 127, 1892, 349, 1893, 537, 1892, 659, 1784, 847,
+    1803, 1141, 2054, 998, 2282, 710, 2283, 537, 2282, 282, 1714, -29, 1255, -29, 792, -29,
+    226, 282, 227, 537, 226, 787, 778, 1098, 1221, 1098, 1256, 1098, 1360, 1093, 1445, 1088,
+    1127, 1268, 489, 1161, 423, 1260, 985, 1352, 623, 1556, 1079, 1556, 1333, 1411, 1999, 1522,
+    2065, 1425, 1475, 1327, 1471, 1135, 1963, 1135, 1963, 889, 1471, 889, 1471, 395, 1963, 395,
+    1963, 150, 1471, 150, 435, 727, 2999, 727, 2999, 557, 435, 557, 1811, 801, 837, 209,
+    918, 167, 1124, 127, 1255, 127, 1548, 127, 1892, 359, 1893, 559, 1892, 638, 1852, 755,
+    1669, 909, 1584, 950, 1378, 991, 1255, 991, 952, 991, 614, 756, 615, 545, 614, 473,
+    652, 363, 693, 317, 443, 166, 334, 243, 226, 440, 227, 559, 226, 835, 772, 1147,
+    1255, 1147, 1440, 1147, 1758, 1096, 1893, 1044, 2171, 1212, 2361, 1133, 2069, 954, 2174, 877,
+    2282, 679, 2283, 559, 2282, 284, 1734, -29, 1255, -29, 1062, -29, 740, 23, 615, 74,
+    337, -94, 145, -16, 743, 168, 743, -426, 373, -426, 373, 1556, 743, 1556, 743, 950,
+    858, 1050, 1212, 1147, 1459, 1147, 1866, 1147, 2376, 823, 2377, 559, 2376, 295, 1866, -29,
+    1459, -29, 1212, -29, 858, 68, 1995, 559, 1994, 762, 1660, 993, 1369, 993, 1076, 993,
+    742, 762, 743, 559, 742, 356, 1076, 125, 1369, 125, 1660, 125, 1994, 356, 399, 1608,
+    635, 1608, 656, 1533, 850, 1458, 1025, 1458, 1196, 1458, 1388, 1532, 1415, 1608, 1651, 1608,
+    1630, 1465, 1314, 1321, 1025, 1321, 734, 1321, 418, 1465, 1861, 950, 1861, 1284, 1209, 1284,
+    1209, 1409, 1861, 1409, 1861, 1556, 2229, 1556, 2229, 1409, 2537, 1409, 2537, 1284, 2229, 1284,
+    2229, 0, 1861, 0, 1861, 168, 1744, 68, 1390, -29, 1143, -29, 736, -29, 226, 295,
+    227, 559, 226, 823, 736, 1147, 1143, 1147, 1390, 1147, 1744, 1050, 607, 559, 606, 356,
+    940, 125, 1233, 125, 1524, 125, 1860, 356, 1861, 559, 1860, 762, 1524, 993, 1233, 993,
+    940, 993, 606, 762, -543, 983, -543, 1102, -422, 1057, -246, 1014, -183, 1014, -92, 1014,
+    0, 1069, 1, 1123, 0, 1155, -30, 1217, -59, 1248, 207, 1248, 226, 1210, 246, 1142,
+    247, 1112, 246, 990, 72, 875, -113, 875, -210, 875, -420, 928, -1211, -141, -843, -141,
+    -843, -375, -1211, -375, -1425, 1608, -1202, 1659, -991, 1659, -784, 1659, -530, 1574, -529, 1507,
+    -530, 1446, -705, 1381, -793, 1349, -864, 1323, -871, 1314, -886, 1298, -885, 1266, -1123, 1266,
+    -1123, 1278, -1124, 1318, -1064, 1372, -961, 1409, -871, 1443, -780, 1477, -779, 1517, -780, 1538,
+    -904, 1574, -1045, 1574, -1226, 1574, -1425, 1522, -1649, 1528, -1413, 1528, -1388, 1474, -1190, 1417,
+    -1023, 1417, -860, 1417, -666, 1472, -633, 1528, -397, 1528, -418, 1409, -738, 1286, -1023, 1286,
+    -1312, 1286, -1630, 1408, 201, 633, 1849, 633, 1849, 489, 201, 489, 201, 633, 3897, 633,
+    3897, 489, 201, 489, 771, 1001, 349, 1001, 349, 1174, 677, 1493, 935, 1493, 771, 1174,
+    521, 1493, 943, 1493, 943, 1341, 615, 1022, 357, 1022, 521, 1341, 771, 1001, 349, 1001,
+    349, 1174, 677, 1493, 935, 1493, 771, 1174, 1591, 1001, 1169, 1001, 1169, 1174, 1497, 1493,
+    1755, 1493, 1591, 1174, 513, 1493, 935, 1493, 935, 1321, 607, 1001, 349, 1001, 513, 1321,
+    1333, 1493, 1755, 1493, 1755, 1321, 1427, 1001, 1169, 1001, 1333, 1321, 615, 762, 614, 886,
+    960, 1057, 1213, 1057, 1460, 1057, 1802, 886, 1803, 762, 1802, 637, 1458, 465, 1209, 465,
+    958, 465, 614, 637, 1837, 254, 2261, 254, 2261, 0, 1837, 0, 3199, 254, 3625, 254,
+    3625, 0, 3199, 0, 473, 254, 899, 254, 899, 0, 473, 0, 2335, 1378, 2335, 1165,
+    2152, 1270, 1814, 1360, 1611, 1360, 1296, 1360, 892, 1160, 829, 973, 1983, 973, 1873, 850,
+    797, 850, 792, 826, 790, 780, 791, 745, 790, 713, 792, 667, 797, 643, 1689, 643,
+    1577, 520, 829, 520, 892, 333, 1296, 131, 1611, 131, 1814, 131, 2152, 221, 2335, 326,
+    2335, 115, 2156, 43, 1786, -29, 1595, -29, 1120, -29, 502, 261, 423, 520, 1, 520,
+    111, 643, 389, 643, 388, 666, 386, 713, 387, 745, 386, 780, 388, 827, 389, 850,
+    1, 850, 111, 973, 423, 973, 502, 1230, 1122, 1520, 1595, 1520, 1790, 1520, 2160, 1449,
+    2101, 1868, 4141, 848, 2101, -172, 61, 848, 1897, 254, 1897, 0, 2303, 0, 2303, 254,
+    2291, 401, 2291, 524, 2290, 576, 2302, 636, 2315, 657, 2330, 682, 2369, 708, 2414, 739,
+    2503, 782, 2679, 868, 2862, 958, 2931, 1022, 3002, 1091, 3003, 1167, 3002, 1326, 2556, 1520,
+    2189, 1520, 1982, 1520, 1596, 1464, 1409, 1407, 1409, 1219, 1602, 1286, 1960, 1356, 2119, 1356,
+    2334, 1356, 2596, 1246, 2597, 1157, 2596, 1108, 2494, 1014, 2381, 961, 2201, 872, 2020, 786,
+    1908, 656, 1909, 555, 1909, 401,
+};
+
+} // namespace bundled_font
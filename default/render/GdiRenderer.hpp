@@ -0,0 +1,161 @@
+#pragma once
+#ifdef _WIN32
+#include <windows.h>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "../../core/renderer.hpp"
+#include "../../core/resourceCache.hpp"
+
+inline COLORREF toColorRef(Color c) { return RGB(c.r, c.g, c.b); }
+
+inline HFONT createGdiFont(const FontDesc& f) {
+    HDC screen = GetDC(nullptr);
+    int logpixely = GetDeviceCaps(screen, LOGPIXELSY);
+    ReleaseDC(nullptr, screen);
+
+    int height = -MulDiv((int)std::round(f.sizePt), logpixely, 72);
+
+    return CreateFontW(
+        height, 0, 0, 0,
+        f.weight,
+        f.italic ? TRUE : FALSE,
+        f.underline ? TRUE : FALSE,
+        f.strike ? TRUE : FALSE,
+        DEFAULT_CHARSET,
+        OUT_DEFAULT_PRECIS,
+        CLIP_DEFAULT_PRECIS,
+        CLEARTYPE_QUALITY,
+        DEFAULT_PITCH | FF_DONTCARE,
+        f.name.c_str()
+    );
+}
+
+// -------------------------------
+// GdiResources: interned GDI objects shared by the renderer and the measurer.
+// Identical colors share one brush/pen, identical FontDescs one HFONT.
+struct GdiResources {
+    ResourceCache<Color, HBRUSH, ColorHash> brushes{
+        [](const Color& c) { return CreateSolidBrush(toColorRef(c)); },
+        [](HBRUSH b) { DeleteObject(b); }, 256 };
+    ResourceCache<Color, HPEN, ColorHash> pens{
+        [](const Color& c) { return CreatePen(PS_SOLID, 1, toColorRef(c)); },
+        [](HPEN p) { DeleteObject(p); }, 64 };
+    ResourceCache<FontDesc, HFONT, FontDescHash> fonts{
+        [](const FontDesc& f) { return createGdiFont(f); },
+        [](HFONT f) { DeleteObject(f); }, 64 };
+};
+
+// -------------------------------
+// GdiTextMeasurer: extents from GDI (no line breaks reported)
+class GdiTextMeasurer : public TextMeasurer {
+    GdiResources& res;
+    HDC hdc;
+
+public:
+    explicit GdiTextMeasurer(GdiResources& r) : res(r), hdc(CreateCompatibleDC(nullptr)) {}
+    ~GdiTextMeasurer() override { DeleteDC(hdc); }
+
+    GdiTextMeasurer(const GdiTextMeasurer&) = delete;
+    GdiTextMeasurer& operator=(const GdiTextMeasurer&) = delete;
+
+    TextLayout layoutText(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) override {
+        auto hFont = res.fonts.lease(font);
+        HFONT oldFont = (HFONT)SelectObject(hdc, hFont.get());
+
+        TextLayout out;
+        TEXTMETRICW tmw{};
+        GetTextMetricsW(hdc, &tmw);
+        out.lineHeight = tmw.tmHeight;
+
+        if (!wrap) {
+            SIZE ts{};
+            if (!text.empty()) GetTextExtentPoint32W(hdc, text.data(), (int)text.size(), &ts);
+            else ts.cy = tmw.tmHeight;
+            out.extent = { (double)ts.cx, (double)ts.cy };
+        } else {
+            RECT r = { 0, 0, maxWidth > 0 ? (LONG)maxWidth : 0, 0 };
+            DrawTextW(hdc, text.data(), (int)text.size(), &r, DT_CALCRECT | DT_WORDBREAK | DT_NOPREFIX);
+            out.extent = { (double)(r.right - r.left), (double)(r.bottom - r.top) };
+        }
+
+        SelectObject(hdc, oldFont);
+        return out;
+    }
+};
+
+// -------------------------------
+// GdiRenderer: draws into a Win32 HDC
+class GdiRenderer : public Renderer {
+    HDC hdc;
+    GdiResources res;
+    GdiTextMeasurer textMeasure{res};
+
+public:
+    explicit GdiRenderer(HDC dc) : hdc(dc) {}
+
+    // interned brushes/pens/fonts: sizes, hit/miss counters, capacity
+    GdiResources& resources() { return res; }
+
+    void setDC(HDC dc) { hdc = dc; }
+    HDC dc() const { return hdc; }
+
+    void fillRect(const Rect& r, Color c) override {
+        RECT rc = { (LONG)r.x, (LONG)r.y, (LONG)(r.x + r.w), (LONG)(r.y + r.h) };
+        auto brush = res.brushes.lease(c);
+        FillRect(hdc, &rc, brush.get());
+    }
+
+    void drawLine(double x0, double y0, double x1, double y1, Color c) override {
+        auto pen = res.pens.lease(c);
+        HGDIOBJ hOldPen = SelectObject(hdc, pen.get());
+        MoveToEx(hdc, (int)x0, (int)y0, nullptr);
+        LineTo(hdc, (int)x1, (int)y1);
+        SetPixel(hdc, (int)x1, (int)y1, toColorRef(c));   // LineTo excludes the end point
+        SelectObject(hdc, hOldPen);
+    }
+
+    void pushClip(const Rect& r) override {
+        SaveDC(hdc);
+        IntersectClipRect(hdc, (int)r.x, (int)r.y, (int)(r.x + r.w), (int)(r.y + r.h));
+    }
+
+    void popClip() override {
+        RestoreDC(hdc, -1);
+    }
+
+    Rect clipBounds() const override {
+        RECT rc{};
+        if (GetClipBox(hdc, &rc) == NULLREGION) return {0, 0, 0, 0};
+        return { (double)rc.left, (double)rc.top, (double)(rc.right - rc.left), (double)(rc.bottom - rc.top) };
+    }
+
+    // DrawTextW does its own line breaking, so a precomputed layout is not needed
+    void drawText(const Rect& box, std::wstring_view text, const FontDesc& font, Color color, const TextFormat& fmt,
+                  const TextLayout* = nullptr) override {
+        auto hFont = res.fonts.lease(font);
+        HFONT oldFont = (HFONT)SelectObject(hdc, hFont.get());
+        SetBkMode(hdc, TRANSPARENT);
+        SetTextColor(hdc, toColorRef(color));
+
+        RECT r = { (LONG)box.x, (LONG)box.y, (LONG)(box.x + box.w), (LONG)(box.y + box.h) };
+        UINT flags = DT_NOPREFIX;
+        if (fmt.wrap) {
+            flags |= DT_WORDBREAK;
+        } else {
+            flags |= DT_SINGLELINE;
+            if (fmt.ellipsize) flags |= DT_END_ELLIPSIS;
+            if (fmt.vAlign == Align::Center) flags |= DT_VCENTER;
+            else if (fmt.vAlign == Align::End) flags |= DT_BOTTOM;
+        }
+        if (fmt.hAlign == Align::Center) flags |= DT_CENTER;
+        else if (fmt.hAlign == Align::End) flags |= DT_RIGHT;
+
+        DrawTextW(hdc, text.data(), (int)text.size(), &r, flags);
+
+        SelectObject(hdc, oldFont);
+    }
+
+    TextMeasurer& measurer() override { return textMeasure; }
+};
+#endif
@@ -0,0 +1,457 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "../../core/text.hpp"
+#include "../../core/profiler.hpp"
+#include "BundledFont.hpp"
+
+// -------------------------------
+// Software text: the bundled outline font (BundledFont.hpp), an antialiased
+// rasterizer for it, a glyph cache packing rasterized glyphs into atlas pages,
+// and the measurer reporting the same advances the renderer draws with.
+// Every FontDesc maps to the one bundled face; size, weight and italic are
+// honoured (bold and italic are synthesized).
+
+// coverage of one glyph, 0..255; pen at (0, baseline)
+struct GlyphMask {
+    int w = 0, h = 0;
+    int left = 0;    // first column relative to the pen
+    int top = 0;     // rows above the baseline
+    std::vector<uint8_t> coverage;
+};
+
+class OutlineFont {
+public:
+    static constexpr double ITALIC_SLANT = 0.2;
+
+    static const OutlineFont& bundled() {
+        static const OutlineFont f;
+        return f;
+    }
+
+    double scale(double px) const { return px / bundled_font::unitsPerEm; }
+    double ascent(double px) const { return bundled_font::ascender * scale(px); }
+    double descent(double px) const { return -bundled_font::descender * scale(px); }
+    double lineHeight(double px) const {
+        return std::ceil((bundled_font::ascender - bundled_font::descender + bundled_font::lineGap) * scale(px));
+    }
+
+    // extra width of synthesized bold: the mask is smeared this many pixels right
+    static int boldShift(double px) { return std::max(1, (int)std::lround(px / 14)); }
+
+    double advance(uint32_t cp, double px, bool bold) const {
+        const uint32_t* g = glyph(cp);
+        return g[1] * scale(px) + (bold ? boldShift(px) : 0);
+    }
+
+    bool hasGlyph(uint32_t cp) const { return find(cp) != nullptr; }
+
+    GlyphMask rasterize(uint32_t cp, double px, bool bold, bool italic) const {
+        const uint32_t* g = glyph(cp);
+        double s = scale(px), slant = italic ? ITALIC_SLANT : 0;
+        auto toPx = [&](double x, double y) { return Point{ (x + y * slant) * s, y * s }; };
+
+        // bounds first, so the mask is allocated once
+        double x0 = 1e30, y0 = 1e30, x1 = -1e30, y1 = -1e30;
+        forEachPoint(g, [&](double x, double y, bool) {
+            Point p = toPx(x, y);
+            x0 = std::min(x0, p.x), x1 = std::max(x1, p.x);
+            y0 = std::min(y0, p.y), y1 = std::max(y1, p.y);
+        });
+        GlyphMask m;
+        if (x0 > x1) return m;   // blank (space)
+        int shift = bold ? boldShift(px) : 0;
+        m.left = (int)std::floor(x0) - 1;
+        m.top = (int)std::ceil(y1) + 1;
+        m.w = (int)std::ceil(x1) + 1 - m.left + shift;
+        m.h = m.top - ((int)std::floor(y0) - 1);
+
+        Raster r(m.w, m.h);
+        for (uint16_t part = 0; part < g[3]; ++part) {
+            const int16_t* pr = bundled_font::parts + 3 * (g[2] + part);
+            const uint16_t* outline = bundled_font::outlines + 2 * pr[0];
+            for (uint16_t c = outline[0]; c < outline[0] + outline[1]; ++c) {
+                uint16_t begin = c == 0 ? 0 : bundled_font::contourEnds[c - 1], end = bundled_font::contourEnds[c];
+                contour(r, begin, end, [&](int16_t x, int16_t y) {
+                    Point p = toPx(x + pr[1], y + pr[2]);
+                    return Point{ p.x - m.left, m.top - p.y };
+                });
+            }
+        }
+        r.finish(m.coverage);
+        if (shift) {
+            for (int y = 0; y < m.h; ++y) {
+                uint8_t* row = m.coverage.data() + (size_t)y * m.w;
+                for (int x = m.w - 1; x > 0; --x)
+                    for (int k = 1; k <= shift && k <= x; ++k) row[x] = std::max(row[x], row[x - k]);
+            }
+        }
+        return m;
+    }
+
+private:
+    struct Point { double x, y; };
+
+    // glyph record (codepoint, advance, first part, part count) or nullptr
+    static const uint32_t* find(uint32_t cp) {
+        constexpr size_t count = sizeof(bundled_font::glyphs) / sizeof(bundled_font::glyphs[0]) / 4;
+        size_t lo = 0, hi = count;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (bundled_font::glyphs[4 * mid] < cp) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < count && bundled_font::glyphs[4 * lo] == cp ? bundled_font::glyphs + 4 * lo : nullptr;
+    }
+
+    // control characters draw as spaces, anything else missing as U+FFFD
+    static const uint32_t* glyph(uint32_t cp) {
+        if (cp < 0x20) cp = 0x20;
+        if (const uint32_t* g = find(cp)) return g;
+        return find(0xFFFD);
+    }
+
+    template <typename Fn>
+    static void forEachPoint(const uint32_t* g, Fn&& fn) {
+        for (uint16_t part = 0; part < g[3]; ++part) {
+            const int16_t* pr = bundled_font::parts + 3 * (g[2] + part);
+            const uint16_t* outline = bundled_font::outlines + 2 * pr[0];
+            uint16_t begin = outline[0] == 0 ? 0 : bundled_font::contourEnds[outline[0] - 1];
+            uint16_t end = bundled_font::contourEnds[outline[0] + outline[1] - 1];
+            for (uint16_t i = begin; i < end; ++i)
+                fn(double((bundled_font::points[2 * i] >> 1) + pr[1]), double(bundled_font::points[2 * i + 1] + pr[2]),
+                   bundled_font::points[2 * i] & 1);
+        }
+    }
+
+    // Signed-area accumulation: every edge adds its coverage delta to the
+    // cells it crosses, a running sum over each row gives the coverage.
+    class Raster {
+        int w, h;
+        std::vector<float> acc;
+
+    public:
+        Raster(int w_, int h_) : w(w_), h(h_), acc((size_t)w_ * h_ + 4, 0.0f) {}
+
+        void line(Point p0, Point p1) {
+            if (p0.y == p1.y) return;
+            float dir = 1;
+            if (p0.y > p1.y) {
+                std::swap(p0, p1);
+                dir = -1;
+            }
+            double dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+            double x = p0.x;
+            int yEnd = std::min(h, (int)std::ceil(p1.y));
+            for (int y = std::max(0, (int)p0.y); y < yEnd; ++y) {
+                float* row = acc.data() + (size_t)y * w;
+                double dy = std::min<double>(y + 1, p1.y) - std::max<double>(y, p0.y);
+                double xNext = x + dxdy * dy;
+                double d = dy * dir;
+                double xa = std::min(x, xNext), xb = std::max(x, xNext);
+                double xaFloor = std::floor(xa);
+                int xai = (int)xaFloor, xbi = (int)std::ceil(xb);
+                if (xbi <= xai + 1) {
+                    // within one column
+                    double xm = 0.5 * (x + xNext) - xaFloor;
+                    row[xai] += float(d - d * xm);
+                    row[xai + 1] += float(d * xm);
+                } else {
+                    double s = 1 / (xb - xa);
+                    double xaf = xa - xaFloor;
+                    double a0 = 0.5 * s * (1 - xaf) * (1 - xaf);
+                    double xbf = xb - xbi + 1;
+                    double am = 0.5 * s * xbf * xbf;
+                    row[xai] += float(d * a0);
+                    if (xbi == xai + 2) {
+                        row[xai + 1] += float(d * (1 - a0 - am));
+                    } else {
+                        double a1 = s * (1.5 - xaf);
+                        row[xai + 1] += float(d * (a1 - a0));
+                        for (int xi = xai + 2; xi < xbi - 1; ++xi) row[xi] += float(d * s);
+                        double a2 = a1 + (xbi - xai - 3) * s;
+                        row[xbi - 1] += float(d * (1 - a2 - am));
+                    }
+                    row[xbi] += float(d * am);
+                }
+                x = xNext;
+            }
+        }
+
+        void quad(Point p0, Point c, Point p1) {
+            double ddx = p0.x - 2 * c.x + p1.x, ddy = p0.y - 2 * c.y + p1.y;
+            double dev = ddx * ddx + ddy * ddy;
+            if (dev < 0.333) {
+                line(p0, p1);
+                return;
+            }
+            int n = 1 + (int)std::floor(std::sqrt(std::sqrt(3 * dev)));
+            Point prev = p0;
+            for (int i = 1; i <= n; ++i) {
+                double t = double(i) / n, u = 1 - t;
+                Point p{ u * u * p0.x + 2 * u * t * c.x + t * t * p1.x, u * u * p0.y + 2 * u * t * c.y + t * t * p1.y };
+                line(prev, p);
+                prev = p;
+            }
+        }
+
+        void finish(std::vector<uint8_t>& out) {
+            out.resize((size_t)w * h);
+            float sum = 0;
+            for (size_t i = 0; i < out.size(); ++i) {
+                sum += acc[i];
+                out[i] = (uint8_t)std::lround(std::min(1.0f, std::abs(sum)) * 255);
+            }
+        }
+    };
+
+    // one TrueType contour: on-curve points joined by lines, off-curve points
+    // are quadratic controls with implied on-curve midpoints between them
+    template <typename Map>
+    static void contour(Raster& r, uint16_t begin, uint16_t end, Map&& map) {
+        int n = end - begin;
+        if (n < 2) return;
+        auto at = [&](int i) {
+            i = begin + (i % n);
+            return std::make_pair(map(bundled_font::points[2 * i] >> 1, bundled_font::points[2 * i + 1]),
+                                  (bool)(bundled_font::points[2 * i] & 1));
+        };
+        auto mid = [](Point a, Point b) { return Point{ (a.x + b.x) / 2, (a.y + b.y) / 2 }; };
+
+        int first = 0;
+        while (first < n && !at(first).second) ++first;
+        Point start = first < n ? at(first).first : mid(at(n - 1).first, at(0).first);
+        if (first == n) first = -1;
+
+        Point cur = start, ctrl{};
+        bool pending = false;
+        for (int k = first + 1; k <= first + n; ++k) {
+            if (k == first + n && first >= 0) break;   // back at the start point
+            auto [p, on] = at(k);
+            if (on) {
+                if (pending) r.quad(cur, ctrl, p);
+                else r.line(cur, p);
+                cur = p;
+                pending = false;
+            } else {
+                if (pending) {
+                    Point m = mid(ctrl, p);
+                    r.quad(cur, ctrl, m);
+                    cur = m;
+                }
+                ctrl = p;
+                pending = true;
+            }
+        }
+        if (pending) r.quad(cur, ctrl, start);
+        else r.line(cur, start);
+    }
+};
+
+// -------------------------------
+// GlyphCache: (codepoint, pixel size, bold, italic) -> glyph rasterized once
+// into an atlas page. Pages are shelf-packed; when all maxPages are full the
+// least recently used page is dropped with its glyphs. Thread-safe; a page
+// handed out stays valid while its Glyph is held, even after eviction.
+class GlyphCache {
+public:
+    struct Page {
+        int size;
+        std::vector<uint8_t> pixels;   // size x size coverage
+        uint64_t lastUse = 0;
+        std::vector<uint64_t> keys;    // glyphs living here
+        int shelfX = 0, shelfY = 0, shelfH = 0;
+
+        explicit Page(int s) : size(s), pixels((size_t)s * s, 0) {}
+        const uint8_t* row(int y) const { return pixels.data() + (size_t)y * size; }
+    };
+
+    struct Glyph {
+        std::shared_ptr<const Page> page;   // null for blank glyphs
+        int x = 0, y = 0, w = 0, h = 0;     // rect in the page
+        int left = 0, top = 0;              // placement relative to pen/baseline
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;   // pages dropped
+    };
+
+private:
+    struct Entry {
+        Glyph glyph;
+        size_t page;              // index into pages
+    };
+
+    mutable std::mutex mtx;
+    std::vector<std::shared_ptr<Page>> pages;
+    std::unordered_map<uint64_t, Entry> index;
+    uint64_t clock = 0;
+    Stats counters;
+    int pageSize = 512;
+    size_t maxPages = 8;
+
+public:
+    GlyphCache() = default;
+    GlyphCache(int pagePixels, size_t pageLimit) : pageSize(pagePixels), maxPages(std::max<size_t>(1, pageLimit)) {}
+
+    Glyph get(const OutlineFont& font, uint32_t cp, double px, bool bold, bool italic) {
+        uint64_t k = key(cp, px, bold, italic);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto it = index.find(k);
+            if (it != index.end()) {
+                ++counters.hits;
+                PROF_COUNT(GLYPH_HITS);
+                if (it->second.page != npos()) pages[it->second.page]->lastUse = ++clock;
+                return it->second.glyph;
+            }
+        }
+        PROF_COUNT(GLYPH_MISSES);
+        // rasterize without the lock, so threads missing different glyphs overlap
+        GlyphMask m = font.rasterize(cp, px, bold, italic);
+
+        std::lock_guard<std::mutex> lock(mtx);
+        ++counters.misses;
+        auto it = index.find(k);
+        if (it != index.end()) return it->second.glyph;   // another thread won
+
+        Glyph g;
+        g.left = m.left;
+        g.top = m.top;
+        g.w = m.w;
+        g.h = m.h;
+        if (m.w == 0 || m.h == 0) {
+            index.emplace(k, Entry{ g, npos() });
+            return g;
+        }
+        if (m.w + 1 > pageSize || m.h + 1 > pageSize) {
+            // bigger than a page: a private page, not cached
+            auto own = std::make_shared<Page>(std::max(m.w, m.h));
+            copyMask(*own, 0, 0, m);
+            g.page = own;
+            return g;
+        }
+        size_t p = allocate(m.w + 1, m.h + 1, g.x, g.y);   // 1px gutter against bleeding
+        copyMask(*pages[p], g.x, g.y, m);
+        pages[p]->keys.push_back(k);
+        pages[p]->lastUse = ++clock;
+        g.page = pages[p];
+        index.emplace(k, Entry{ g, p });
+        return g;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        index.clear();
+        pages.clear();
+    }
+
+    // resizes the atlas; drops every cached glyph
+    void setLimits(int pagePixels, size_t pageLimit) {
+        std::lock_guard<std::mutex> lock(mtx);
+        pageSize = pagePixels;
+        maxPages = std::max<size_t>(1, pageLimit);
+        index.clear();
+        pages.clear();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return index.size();
+    }
+    size_t pageCount() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return pages.size();
+    }
+    Stats stats() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return counters;
+    }
+    void resetStats() {
+        std::lock_guard<std::mutex> lock(mtx);
+        counters = {};
+    }
+
+private:
+    static constexpr size_t npos() { return ~size_t(0); }
+
+    // size in 1/64 px: nearby sizes that round the same share glyphs
+    static uint64_t key(uint32_t cp, double px, bool bold, bool italic) {
+        uint64_t size = (uint64_t)std::lround(std::max(0.0, px) * 64);
+        return size << 23 | (uint64_t)bold << 22 | (uint64_t)italic << 21 | (cp & 0x1FFFFF);
+    }
+
+    static void copyMask(Page& p, int x, int y, const GlyphMask& m) {
+        for (int r = 0; r < m.h; ++r)
+            std::copy_n(m.coverage.data() + (size_t)r * m.w, m.w, p.pixels.data() + (size_t)(y + r) * p.size + x);
+    }
+
+    static bool fits(Page& p, int w, int h, int& x, int& y) {
+        if (p.shelfX + w > p.size) {   // next shelf
+            p.shelfY += p.shelfH;
+            p.shelfX = 0;
+            p.shelfH = 0;
+        }
+        if (p.shelfY + h > p.size) return false;
+        x = p.shelfX;
+        y = p.shelfY;
+        p.shelfX += w;
+        p.shelfH = std::max(p.shelfH, h);
+        return true;
+    }
+
+    // newest page first; a new page while under the limit; else the LRU page is recycled
+    size_t allocate(int w, int h, int& x, int& y) {
+        if (!pages.empty() && fits(*pages.back(), w, h, x, y)) return pages.size() - 1;
+        for (size_t i = 0; i + 1 < pages.size(); ++i)
+            if (fits(*pages[i], w, h, x, y)) return i;
+        size_t p = pages.size();
+        if (pages.size() < maxPages) {
+            pages.push_back(std::make_shared<Page>(pageSize));
+        } else {
+            p = 0;
+            for (size_t i = 1; i < pages.size(); ++i)
+                if (pages[i]->lastUse < pages[p]->lastUse) p = i;
+            for (uint64_t k : pages[p]->keys) index.erase(k);
+            pages[p] = std::make_shared<Page>(pageSize);   // holders of the old page keep it alive
+            ++counters.evictions;
+        }
+        fits(*pages[p], w, h, x, y);
+        return p;
+    }
+};
+
+inline GlyphCache& glyphCache() {
+    static GlyphCache c;
+    return c;
+}
+
+// -------------------------------
+// Measurer with the bundled font's advances: what SoftwareRenderer draws.
+class GlyphTextMeasurer : public TextMeasurer {
+public:
+    TextLayout layoutText(const FontDesc& font, std::wstring_view text, double maxWidth, bool wrap) override {
+        const OutlineFont& f = OutlineFont::bundled();
+        double px = font.pixelSize();
+        bool bold = font.weight >= FONT_WEIGHT_BOLD;
+        return wrapText(text, maxWidth, wrap, f.lineHeight(px), [&](wchar_t ch) { return f.advance(ch, px, bold); });
+    }
+
+    double charAdvance(const FontDesc& font, wchar_t ch) override {
+        return OutlineFont::bundled().advance(ch, font.pixelSize(), font.weight >= FONT_WEIGHT_BOLD);
+    }
+
+    bool threadSafe() const override { return true; }
+};
+
+inline GlyphTextMeasurer& glyphTextMeasurer() {
+    static GlyphTextMeasurer m;
+    return m;
+}
@@ -0,0 +1,292 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include "../../core/renderer.hpp"
+
+// -------------------------------
+// Pixel kernels for the software surface: solid fill, constant-color blend,
+// rectangle copy, per-pixel src-over copy and coverage-mask blend (glyphs),
+// on RGBA8 (Color::packed()) rows. Scalar, SSE2 and AVX2 versions give bit-identical results; the best
+// one the CPU supports is picked at runtime (setPixelIsa() overrides it for
+// tests and benchmarks).
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define WIDGET_PIXEL_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define WIDGET_TARGET_SSE2
+        #define WIDGET_TARGET_AVX2
+    #else
+        #define WIDGET_TARGET_SSE2 __attribute__((target("sse2")))
+        #define WIDGET_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+enum class PixelIsa { Scalar, SSE2, AVX2 };
+
+struct PixelKernels {
+    PixelIsa isa;
+    const char* name;
+    // w x h pixels starting at dst, rows stride pixels apart
+    void (*fill)(uint32_t* dst, size_t stride, int w, int h, uint32_t px);
+    void (*blend)(uint32_t* dst, size_t stride, int w, int h, Color c);   // src-over, straight alpha
+    void (*copy)(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h);
+    void (*blendCopy)(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h);
+    // c src-over with its alpha scaled by an 8-bit coverage mask (glyphs)
+    void (*blendMask)(uint32_t* dst, size_t dstStride, const uint8_t* mask, size_t maskStride, int w, int h, Color c);
+};
+
+// fills bigger than this bypass the cache (non-temporal stores): a 4K frame
+// does not fit anyway and the stores skip reading the old pixels first
+constexpr size_t PIXEL_STREAM_BYTES = 4u << 20;
+
+// src-over of one pixel with straight alpha; same rounding as the vector code:
+// every channel is (s * a + d * (255 - a) + 127) / 255, alpha uses s = 255
+inline uint32_t blendPixel(uint32_t dst, uint32_t src) {
+    uint32_t a = src >> 24, ia = 255 - a;
+    uint32_t out = 0;
+    for (int sh = 0; sh < 32; sh += 8) {
+        uint32_t s = sh == 24 ? 255 : (src >> sh) & 0xFF;
+        uint32_t d = (dst >> sh) & 0xFF;
+        out |= ((s * a + d * ia + 127) / 255) << sh;
+    }
+    return out;
+}
+
+inline uint32_t blendPixel(uint32_t dst, Color c) { return blendPixel(dst, c.packed()); }
+
+// ---- scalar ----
+namespace pixel_scalar {
+
+inline void fill(uint32_t* dst, size_t stride, int w, int h, uint32_t px) {
+    for (int y = 0; y < h; ++y, dst += stride)
+        for (int x = 0; x < w; ++x) dst[x] = px;
+}
+
+inline void blend(uint32_t* dst, size_t stride, int w, int h, Color c) {
+    uint32_t src = c.packed();
+    for (int y = 0; y < h; ++y, dst += stride)
+        for (int x = 0; x < w; ++x) dst[x] = blendPixel(dst[x], src);
+}
+
+// libc memcpy is already vectorized (and streams huge copies): every ISA uses it
+inline void copy(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h) {
+    for (int y = 0; y < h; ++y, dst += dstStride, src += srcStride) std::memcpy(dst, src, (size_t)w * 4);
+}
+
+inline void blendCopy(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h) {
+    for (int y = 0; y < h; ++y, dst += dstStride, src += srcStride)
+        for (int x = 0; x < w; ++x) dst[x] = blendPixel(dst[x], src[x]);
+}
+
+// glyph masks are mostly empty or solid: per-pixel branches beat vector code here
+inline void blendMask(uint32_t* dst, size_t dstStride, const uint8_t* mask, size_t maskStride, int w, int h, Color c) {
+    uint32_t rgb = c.packed() & 0xFFFFFF;
+    for (int y = 0; y < h; ++y, dst += dstStride, mask += maskStride) {
+        for (int x = 0; x < w; ++x) {
+            uint32_t a = (mask[x] * c.a + 127) / 255;
+            if (a == 255) dst[x] = rgb | 0xFF000000u;
+            else if (a) dst[x] = blendPixel(dst[x], rgb | a << 24);
+        }
+    }
+}
+
+} // namespace pixel_scalar
+
+#ifdef WIDGET_PIXEL_X86
+// ---- SSE2: 4 pixels per step, channels widened to 16 bits ----
+namespace pixel_sse2 {
+
+// v / 255 for v <= 65152 (exact): (v * 0x8081) >> 23
+WIDGET_TARGET_SSE2 inline __m128i div255(__m128i v) {
+    return _mm_srli_epi16(_mm_mulhi_epu16(v, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+WIDGET_TARGET_SSE2 inline void fill(uint32_t* dst, size_t stride, int w, int h, uint32_t px) {
+    __m128i v = _mm_set1_epi32((int)px);
+    bool stream = (size_t)w * h * 4 >= PIXEL_STREAM_BYTES;
+    for (int y = 0; y < h; ++y, dst += stride) {
+        int x = 0;
+        if (stream) {
+            for (; x < w && ((uintptr_t)(dst + x) & 15); ++x) dst[x] = px;
+            for (; x + 4 <= w; x += 4) _mm_stream_si128((__m128i*)(dst + x), v);
+        } else {
+            for (; x + 4 <= w; x += 4) _mm_storeu_si128((__m128i*)(dst + x), v);
+        }
+        for (; x < w; ++x) dst[x] = px;
+    }
+    if (stream) _mm_sfence();
+}
+
+WIDGET_TARGET_SSE2 inline void blend(uint32_t* dst, size_t stride, int w, int h, Color c) {
+    uint32_t src = c.packed();
+    short a = c.a, ia = 255 - c.a;
+    // per channel: s * a + 127 (alpha: 255 * a + 127), for two pixels
+    __m128i k = _mm_setr_epi16(c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127,
+                               c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127);
+    __m128i via = _mm_set1_epi16(ia), zero = _mm_setzero_si128();
+    for (int y = 0; y < h; ++y, dst += stride) {
+        int x = 0;
+        for (; x + 4 <= w; x += 4) {
+            __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+            __m128i lo = div255(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), via), k));
+            __m128i hi = div255(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), via), k));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(lo, hi));
+        }
+        for (; x < w; ++x) dst[x] = blendPixel(dst[x], src);
+    }
+}
+
+// two pixels widened: s * a + d * (255 - a) + 127, alpha lane with s = 255
+WIDGET_TARGET_SSE2 inline __m128i blendWide(__m128i s, __m128i d) {
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+    __m128i ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    __m128i s255 = _mm_or_si128(s, _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255));
+    __m128i v = _mm_add_epi16(_mm_mullo_epi16(s255, a), _mm_mullo_epi16(d, ia));
+    return div255(_mm_add_epi16(v, _mm_set1_epi16(127)));
+}
+
+WIDGET_TARGET_SSE2 inline void blendCopy(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h) {
+    __m128i zero = _mm_setzero_si128();
+    for (int y = 0; y < h; ++y, dst += dstStride, src += srcStride) {
+        int x = 0;
+        for (; x + 4 <= w; x += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+            __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+            __m128i lo = blendWide(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+            __m128i hi = blendWide(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(lo, hi));
+        }
+        for (; x < w; ++x) dst[x] = blendPixel(dst[x], src[x]);
+    }
+}
+
+} // namespace pixel_sse2
+
+// ---- AVX2: 8 pixels per step (unpack/pack work per 128-bit lane, order is kept) ----
+namespace pixel_avx2 {
+
+WIDGET_TARGET_AVX2 inline __m256i div255(__m256i v) {
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(v, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+WIDGET_TARGET_AVX2 inline void fill(uint32_t* dst, size_t stride, int w, int h, uint32_t px) {
+    __m256i v = _mm256_set1_epi32((int)px);
+    bool stream = (size_t)w * h * 4 >= PIXEL_STREAM_BYTES;
+    for (int y = 0; y < h; ++y, dst += stride) {
+        int x = 0;
+        if (stream) {
+            for (; x < w && ((uintptr_t)(dst + x) & 31); ++x) dst[x] = px;
+            for (; x + 8 <= w; x += 8) _mm256_stream_si256((__m256i*)(dst + x), v);
+        } else {
+            for (; x + 8 <= w; x += 8) _mm256_storeu_si256((__m256i*)(dst + x), v);
+        }
+        for (; x < w; ++x) dst[x] = px;
+    }
+    if (stream) _mm_sfence();
+}
+
+WIDGET_TARGET_AVX2 inline void blend(uint32_t* dst, size_t stride, int w, int h, Color c) {
+    uint32_t src = c.packed();
+    short a = c.a, ia = 255 - c.a;
+    __m256i k = _mm256_setr_epi16(c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127,
+                                  c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127,
+                                  c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127,
+                                  c.r * a + 127, c.g * a + 127, c.b * a + 127, 255 * a + 127);
+    __m256i via = _mm256_set1_epi16(ia), zero = _mm256_setzero_si256();
+    for (int y = 0; y < h; ++y, dst += stride) {
+        int x = 0;
+        for (; x + 8 <= w; x += 8) {
+            __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+            __m256i lo = div255(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), via), k));
+            __m256i hi = div255(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), via), k));
+            _mm256_storeu_si256((__m256i*)(dst + x), _mm256_packus_epi16(lo, hi));
+        }
+        for (; x < w; ++x) dst[x] = blendPixel(dst[x], src);
+    }
+}
+
+WIDGET_TARGET_AVX2 inline __m256i blendWide(__m256i s, __m256i d) {
+    __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+    __m256i ia = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+    __m256i s255 = _mm256_or_si256(s, _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255));
+    __m256i v = _mm256_add_epi16(_mm256_mullo_epi16(s255, a), _mm256_mullo_epi16(d, ia));
+    return div255(_mm256_add_epi16(v, _mm256_set1_epi16(127)));
+}
+
+WIDGET_TARGET_AVX2 inline void blendCopy(uint32_t* dst, size_t dstStride, const uint32_t* src, size_t srcStride, int w, int h) {
+    __m256i zero = _mm256_setzero_si256();
+    for (int y = 0; y < h; ++y, dst += dstStride, src += srcStride) {
+        int x = 0;
+        for (; x + 8 <= w; x += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i*)(src + x));
+            __m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+            __m256i lo = blendWide(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero));
+            __m256i hi = blendWide(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero));
+            _mm256_storeu_si256((__m256i*)(dst + x), _mm256_packus_epi16(lo, hi));
+        }
+        for (; x < w; ++x) dst[x] = blendPixel(dst[x], src[x]);
+    }
+}
+
+} // namespace pixel_avx2
+#endif // WIDGET_PIXEL_X86
+
+// ---- dispatch ----
+inline bool cpuSupports(PixelIsa isa) {
+    if (isa == PixelIsa::Scalar) return true;
+#ifdef WIDGET_PIXEL_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int r[4];
+    __cpuid(r, 1);
+    if (isa == PixelIsa::SSE2) return (r[3] >> 26) & 1;
+    bool osAvx = ((r[2] >> 27) & 1) && ((r[2] >> 28) & 1) && (_xgetbv(0) & 6) == 6;
+    __cpuid(r, 0);
+    if (!osAvx || r[0] < 7) return false;
+    __cpuidex(r, 7, 0);
+    return (r[1] >> 5) & 1;
+    #else
+    return isa == PixelIsa::SSE2 ? __builtin_cpu_supports("sse2") : __builtin_cpu_supports("avx2");
+    #endif
+#else
+    return false;
+#endif
+}
+
+// kernels of one ISA (scalar when the build has no such code path)
+inline const PixelKernels& pixelKernels(PixelIsa isa) {
+    static const PixelKernels scalar{ PixelIsa::Scalar, "scalar", pixel_scalar::fill, pixel_scalar::blend,
+                                      pixel_scalar::copy, pixel_scalar::blendCopy, pixel_scalar::blendMask };
+#ifdef WIDGET_PIXEL_X86
+    static const PixelKernels sse2{ PixelIsa::SSE2, "sse2", pixel_sse2::fill, pixel_sse2::blend,
+                                    pixel_scalar::copy, pixel_sse2::blendCopy, pixel_scalar::blendMask };
+    static const PixelKernels avx2{ PixelIsa::AVX2, "avx2", pixel_avx2::fill, pixel_avx2::blend,
+                                    pixel_scalar::copy, pixel_avx2::blendCopy, pixel_scalar::blendMask };
+    if (isa == PixelIsa::AVX2) return avx2;
+    if (isa == PixelIsa::SSE2) return sse2;
+#endif
+    return scalar;
+}
+
+inline PixelIsa bestPixelIsa() {
+    static const PixelIsa best = cpuSupports(PixelIsa::AVX2) ? PixelIsa::AVX2
+                               : cpuSupports(PixelIsa::SSE2) ? PixelIsa::SSE2 : PixelIsa::Scalar;
+    return best;
+}
+
+inline std::atomic<const PixelKernels*>& activePixelKernels() {
+    static std::atomic<const PixelKernels*> active{ &pixelKernels(bestPixelIsa()) };
+    return active;
+}
+
+inline const PixelKernels& pixelKernels() { return *activePixelKernels().load(std::memory_order_relaxed); }
+
+// force an ISA (falls back to scalar if the CPU lacks it); returns the one in use
+inline PixelIsa setPixelIsa(PixelIsa isa) {
+    if (!cpuSupports(isa)) isa = PixelIsa::Scalar;
+    activePixelKernels().store(&pixelKernels(isa), std::memory_order_relaxed);
+    return isa;
+}
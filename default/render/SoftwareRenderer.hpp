@@ -0,0 +1,208 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include "../../core/renderer.hpp"
+#include "PixelKernels.hpp"
+#include "GlyphCache.hpp"
+
+// -------------------------------
+// Framebuffer: plain RGBA8 pixels, row-major, no padding
+struct Framebuffer {
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> pixels;   // Color::packed()
+
+    Framebuffer() = default;
+    Framebuffer(int w, int h) { resize(w, h); }
+
+    void resize(int w, int h) {
+        width = std::max(0, w);
+        height = std::max(0, h);
+        pixels.assign((size_t)width * height, 0);
+    }
+
+    uint32_t* row(int y) { return pixels.data() + (size_t)y * width; }
+    const uint32_t* row(int y) const { return pixels.data() + (size_t)y * width; }
+
+    uint32_t at(int x, int y) const { return row(y)[x]; }
+
+    void clear(Color c) { if (!pixels.empty()) pixelKernels().fill(pixels.data(), width, width, height, c.packed()); }
+};
+
+// integer pixel rect [x0, x1) x [y0, y1)
+struct PixelRect {
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    bool empty() const { return x1 <= x0 || y1 <= y0; }
+
+    PixelRect intersect(const PixelRect& o) const {
+        return { std::max(x0, o.x0), std::max(y0, o.y0), std::min(x1, o.x1), std::min(y1, o.y1) };
+    }
+
+    static PixelRect fromRect(const Rect& r) {
+        return { (int)r.x, (int)r.y, (int)(r.x + r.w), (int)(r.y + r.h) };
+    }
+};
+
+// -------------------------------
+// SoftwareRenderer: CPU backend drawing into a Framebuffer.
+// Runs anywhere (Linux perf boxes, tests) - no windowing system needed;
+// text uses the bundled font through the glyph cache.
+class SoftwareRenderer : public Renderer {
+    Framebuffer* fb;
+    std::vector<PixelRect> clipStack;
+
+public:
+    explicit SoftwareRenderer(Framebuffer& target) : fb(&target) {}
+
+    Framebuffer& target() { return *fb; }
+    void setTarget(Framebuffer& target) { fb = &target; clipStack.clear(); }
+
+    void beginFrame() override { clipStack.clear(); }
+
+    // bundled-font metrics; WidgetManager installs it behind the layout cache
+    TextMeasurer& measurer() override { return glyphTextMeasurer(); }
+
+    PixelRect currentClip() const {
+        PixelRect full{0, 0, fb->width, fb->height};
+        return clipStack.empty() ? full : clipStack.back().intersect(full);
+    }
+
+    void pushClip(const Rect& r) override {
+        clipStack.push_back(currentClip().intersect(PixelRect::fromRect(r)));
+    }
+
+    void popClip() override {
+        if (!clipStack.empty()) clipStack.pop_back();
+    }
+
+    Rect clipBounds() const override {
+        PixelRect c = currentClip();
+        return { (double)c.x0, (double)c.y0, (double)(c.x1 - c.x0), (double)(c.y1 - c.y0) };
+    }
+
+    void fillRect(const Rect& r, Color c) override {
+        fillPixels(PixelRect::fromRect(r).intersect(currentClip()), c);
+    }
+
+    void drawLine(double x0, double y0, double x1, double y1, Color c) override {
+        // Bresenham, clipped per pixel
+        PixelRect clip = currentClip();
+        int ax = (int)x0, ay = (int)y0, bx = (int)x1, by = (int)y1;
+        int dx = std::abs(bx - ax), sx = ax < bx ? 1 : -1;
+        int dy = -std::abs(by - ay), sy = ay < by ? 1 : -1;
+        int err = dx + dy;
+        for (;;) {
+            if (ax >= clip.x0 && ax < clip.x1 && ay >= clip.y0 && ay < clip.y1) plot(ax, ay, c);
+            if (ax == bx && ay == by) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; ax += sx; }
+            if (e2 <= dx) { err += dx; ay += sy; }
+        }
+    }
+
+    void drawText(const Rect& box, std::wstring_view text, const FontDesc& font, Color color, const TextFormat& fmt,
+                  const TextLayout* layout = nullptr) override {
+        TextMeasurer& m = measurer();
+        std::shared_ptr<const TextLayout> owned;
+        if (!layout || layout->lines.empty()) {
+            owned = m.layoutShared(font, text, box.w, fmt.wrap);
+            layout = owned.get();
+        }
+
+        TextLayout ellipsized;
+        if (!fmt.wrap && fmt.ellipsize && layout->extent.w > box.w && !layout->lines.empty()) {
+            // keep characters while text + "..." fits; the dots are drawn as a second run
+            double dots = 3 * m.charAdvance(font, L'.');
+            double w = 0;
+            size_t n = 0;
+            for (; n < text.size(); ++n) {
+                double a = m.charAdvance(font, text[n]);
+                if (w + a + dots > box.w) break;
+                w += a;
+            }
+            ellipsized = *layout;
+            ellipsized.lines = { {0, n, w + dots} };
+            layout = &ellipsized;
+        }
+
+        double y = box.y;
+        if (!fmt.wrap) {
+            if (fmt.vAlign == Align::Center) y += (box.h - layout->extent.h) / 2;
+            else if (fmt.vAlign == Align::End) y += box.h - layout->extent.h;
+        }
+
+        pushClip(box);
+        for (const TextLine& line : layout->lines) {
+            double x = box.x;
+            if (fmt.hAlign == Align::Center) x += (box.w - line.width) / 2;
+            else if (fmt.hAlign == Align::End) x += box.w - line.width;
+            double end = drawRun(x, y, text.substr(line.begin, line.end - line.begin), font, layout->lineHeight, color);
+            if (layout == &ellipsized) drawRun(end, y, L"...", font, layout->lineHeight, color);
+            y += layout->lineHeight;
+        }
+        popClip();
+    }
+
+    // copies src's (sx, sy, w, h) to (dx, dy), clipped; alpha: src-over instead of replacing
+    void blit(const Framebuffer& src, int sx, int sy, int w, int h, int dx, int dy, bool alpha = false) {
+        PixelRect from = PixelRect{sx, sy, sx + w, sy + h}.intersect({0, 0, src.width, src.height});
+        PixelRect to = PixelRect{from.x0 - sx + dx, from.y0 - sy + dy, from.x1 - sx + dx, from.y1 - sy + dy}.intersect(currentClip());
+        if (to.empty()) return;
+        const uint32_t* s = src.row(to.y0 - dy + sy) + (to.x0 - dx + sx);
+        uint32_t* d = fb->row(to.y0) + to.x0;
+        const PixelKernels& k = pixelKernels();
+        if (alpha) k.blendCopy(d, fb->width, s, src.width, to.x1 - to.x0, to.y1 - to.y0);
+        else k.copy(d, fb->width, s, src.width, to.x1 - to.x0, to.y1 - to.y0);
+    }
+
+protected:
+    void plot(int x, int y, Color c) {
+        uint32_t& px = fb->row(y)[x];
+        px = c.a == 255 ? c.packed() : blendPixel(px, c);
+    }
+
+    void fillPixels(const PixelRect& pr, Color c) {
+        if (pr.empty() || c.a == 0) return;
+        const PixelKernels& k = pixelKernels();
+        uint32_t* p = fb->row(pr.y0) + pr.x0;
+        if (c.a == 255) k.fill(p, fb->width, pr.x1 - pr.x0, pr.y1 - pr.y0, c.packed());
+        else k.blend(p, fb->width, pr.x1 - pr.x0, pr.y1 - pr.y0, c);
+    }
+
+    // glyphs are blended from the glyph cache's atlas; the pen moves by the
+    // measurer's advances, so drawn text matches the measured layout
+    // returns the pen position after the run
+    virtual double drawRun(double x, double y, std::wstring_view run, const FontDesc& font, double lineHeight, Color c) {
+        TextMeasurer& m = measurer();
+        const OutlineFont& face = OutlineFont::bundled();
+        double px = font.pixelSize();
+        bool bold = font.weight >= FONT_WEIGHT_BOLD;
+        double ascent = face.ascent(px), descent = face.descent(px);
+        int baseline = (int)std::lround(y + (lineHeight - ascent - descent) / 2 + ascent);
+        PixelRect clip = currentClip();
+        bool rowVisible = baseline - ascent - 2 < clip.y1 && baseline + descent + 2 > clip.y0;
+        double x0 = x;
+        for (wchar_t ch : run) {
+            double adv = m.charAdvance(font, ch);
+            if (rowVisible && ch != L' ' && x - px < clip.x1 && x + adv + px > clip.x0) {
+                GlyphCache::Glyph g = glyphCache().get(face, ch, px, bold, font.italic);
+                if (g.page) drawGlyph(g, (int)std::lround(x) + g.left, baseline - g.top, c);
+            }
+            x += adv;
+        }
+        double stroke = std::max(1.0, std::round(px / 14));
+        if (font.underline) fillRect({x0, baseline + std::round(descent / 2), x - x0, stroke}, c);
+        if (font.strike) fillRect({x0, baseline - std::round(ascent * 0.3), x - x0, stroke}, c);
+        return x;
+    }
+
+    void drawGlyph(const GlyphCache::Glyph& g, int dx, int dy, Color c) {
+        PixelRect to = PixelRect{dx, dy, dx + g.w, dy + g.h}.intersect(currentClip());
+        if (to.empty() || c.a == 0) return;
+        const uint8_t* mask = g.page->row(g.y + to.y0 - dy) + g.x + (to.x0 - dx);
+        pixelKernels().blendMask(fb->row(to.y0) + to.x0, fb->width, mask, g.page->size, to.x1 - to.x0, to.y1 - to.y0, c);
+    }
+};
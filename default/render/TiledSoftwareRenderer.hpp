@@ -0,0 +1,202 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include "../../core/renderer.hpp"
+#include "../../core/taskPool.hpp"
+#include "../../core/parallelLayout.hpp"
+#include "../../core/profiler.hpp"
+#include "SoftwareRenderer.hpp"
+
+// -------------------------------
+// TiledSoftwareRenderer: software backend that rasterizes a frame in tiles on
+// a TaskPool. Draw calls between beginFrame and endFrame are recorded into a
+// DisplayList; endFrame flattens it (child lists inlined, clips resolved),
+// bins every command into the tiles its clipped bounds touch and rasterizes
+// the tiles in parallel. A tile runs its commands in frame order and no two
+// tiles share a pixel, so the result is the same as SoftwareRenderer's for
+// any number of threads.
+class TiledSoftwareRenderer : public Renderer {
+public:
+    struct Stats {
+        size_t commands = 0;        // flattened commands of the last frame
+        size_t binned = 0;          // command/tile pairs
+        size_t tiles = 0;           // tiles with work
+    };
+
+private:
+    Framebuffer* fb;
+    TaskPool* pool;             // nullptr: the shared layout pool
+    int tileSize;
+    RecordingRenderer recorder;
+    bool recording = false;
+
+    struct Cmd {
+        DisplayList::Op op;     // Fill, Line or Text
+        Color color;
+        Rect box;               // window coordinates; Line: (x0, y0, x1, y1)
+        PixelRect clip;
+        const DisplayList::TextRun* text;
+    };
+    std::vector<Cmd> cmds;
+    std::vector<std::vector<uint32_t>> bins;   // command indices per tile, row-major
+    std::shared_ptr<const DisplayList> frame;  // keeps the text runs alive while rasterizing
+    Stats last;
+
+public:
+    explicit TiledSoftwareRenderer(Framebuffer& target, int tile = 128, TaskPool* p = nullptr)
+        : fb(&target), pool(p), tileSize(std::max(16, tile)), recorder(textMeasurer()) {}
+
+    Framebuffer& target() { return *fb; }
+    void setTarget(Framebuffer& target) { fb = &target; }
+    void setTileSize(int px) { tileSize = std::max(16, px); }
+    int getTileSize() const { return tileSize; }
+    const Stats& stats() const { return last; }
+
+    void beginFrame() override {
+        recorder.finish();
+        recording = true;
+    }
+
+    void endFrame() override {
+        if (!recording) return;
+        recording = false;
+        rasterize(recorder.finish());
+    }
+
+    void fillRect(const Rect& r, Color c) override { record().fillRect(r, c); }
+    void drawLine(double x0, double y0, double x1, double y1, Color c) override { record().drawLine(x0, y0, x1, y1, c); }
+    void pushClip(const Rect& r) override { record().pushClip(r); }
+    void popClip() override { record().popClip(); }
+
+    Rect clipBounds() const override {
+        return recorder.clipBounds().intersected({ 0, 0, (double)fb->width, (double)fb->height });
+    }
+
+    void drawText(const Rect& box, std::wstring_view text, const FontDesc& font, Color color, const TextFormat& fmt,
+                  const TextLayout* layout = nullptr) override {
+        record().drawText(box, text, font, color, fmt, layout);
+    }
+
+    void drawList(const std::shared_ptr<const DisplayList>& list, double dx, double dy) override {
+        record().drawList(list, dx, dy);
+    }
+
+    // tiles draw through SoftwareRenderer, so text uses its metrics
+    TextMeasurer& measurer() override { return glyphTextMeasurer(); }
+
+    // rasterizes a recorded frame (e.g. WidgetManager::frameList()) into the target
+    void rasterize(std::shared_ptr<const DisplayList> list) {
+        PROF_SCOPE("rasterize", PHASE_PAINT);
+        frame = std::move(list);
+        cmds.clear();
+        last = {};
+        if (!frame || fb->width <= 0 || fb->height <= 0) return;
+
+        std::vector<PixelRect> clips{ PixelRect{ 0, 0, fb->width, fb->height } };
+        flatten(*frame, 0, 0, clips);
+
+        int cols = (fb->width + tileSize - 1) / tileSize, rows = (fb->height + tileSize - 1) / tileSize;
+        bins.resize((size_t)cols * rows);
+        for (auto& b : bins) b.clear();
+        for (uint32_t i = 0; i < cmds.size(); ++i) {
+            PixelRect b = bounds(cmds[i]);
+            if (b.empty()) continue;
+            for (int ty = b.y0 / tileSize; ty <= (b.y1 - 1) / tileSize; ++ty)
+                for (int tx = b.x0 / tileSize; tx <= (b.x1 - 1) / tileSize; ++tx) bins[(size_t)ty * cols + tx].push_back(i);
+        }
+
+        last.commands = cmds.size();
+        // text is measured while drawing: only fan out when the measurer allows it
+        bool parallel = measurer().threadSafe();
+        TaskPool& tp = pool ? *pool : layoutPool();
+        TaskPool::Group group;
+        for (int ty = 0; ty < rows; ++ty) {
+            for (int tx = 0; tx < cols; ++tx) {
+                const std::vector<uint32_t>& bin = bins[(size_t)ty * cols + tx];
+                if (bin.empty()) continue;
+                ++last.tiles;
+                last.binned += bin.size();
+                PixelRect tile{ tx * tileSize, ty * tileSize, std::min(fb->width, (tx + 1) * tileSize),
+                                std::min(fb->height, (ty + 1) * tileSize) };
+                if (parallel) tp.submit(group, [this, tile, &bin] { rasterTile(tile, bin); });
+                else rasterTile(tile, bin);
+            }
+        }
+        if (parallel) tp.wait(group);
+    }
+
+private:
+    RecordingRenderer& record() {
+        if (!recording) beginFrame();   // drawing outside beginFrame/endFrame: start a frame
+        return recorder;
+    }
+
+    static Rect toRect(const PixelRect& p) {
+        return { (double)p.x0, (double)p.y0, (double)(p.x1 - p.x0), (double)(p.y1 - p.y0) };
+    }
+
+    // child lists inlined at their offsets, clip stack resolved per command
+    void flatten(const DisplayList& list, double dx, double dy, std::vector<PixelRect>& clips) {
+        using Op = DisplayList::Op;
+        size_t base = clips.size();
+        for (const DisplayList::Command& c : list.commands) {
+            Rect box{ c.box.x + dx, c.box.y + dy, c.box.w, c.box.h };
+            switch (c.op) {
+            case Op::Fill:
+                cmds.push_back({ Op::Fill, c.color, box, clips.back(), nullptr });
+                break;
+            case Op::Line:
+                cmds.push_back({ Op::Line, c.color, { box.x, box.y, c.box.w + dx, c.box.h + dy }, clips.back(), nullptr });
+                break;
+            case Op::Text:
+                cmds.push_back({ Op::Text, c.color, box, clips.back(), &list.texts[c.index] });
+                break;
+            case Op::PushClip:
+                clips.push_back(clips.back().intersect(PixelRect::fromRect(box)));
+                break;
+            case Op::PopClip:
+                if (clips.size() > base) clips.pop_back();
+                break;
+            case Op::List:
+                flatten(*list.lists[c.index], dx + c.dx, dy + c.dy, clips);
+                break;
+            }
+        }
+        clips.resize(base);   // unbalanced pushes don't leak out of a child list
+    }
+
+    static PixelRect bounds(const Cmd& c) {
+        PixelRect b;
+        if (c.op == DisplayList::Op::Line) {
+            int x0 = (int)c.box.x, y0 = (int)c.box.y, x1 = (int)c.box.w, y1 = (int)c.box.h;
+            b = { std::min(x0, x1), std::min(y0, y1), std::max(x0, x1) + 1, std::max(y0, y1) + 1 };
+        } else {
+            b = PixelRect::fromRect(c.box);   // text is clipped to its box
+        }
+        return b.intersect(c.clip);
+    }
+
+    void rasterTile(const PixelRect& tile, const std::vector<uint32_t>& bin) {
+        PROF_SCOPE("rasterTile", PHASE_PAINT);
+        SoftwareRenderer r(*fb);
+        r.pushClip(toRect(tile));
+        for (uint32_t i : bin) {
+            const Cmd& c = cmds[i];
+            r.pushClip(toRect(c.clip));
+            switch (c.op) {
+            case DisplayList::Op::Fill:
+                r.fillRect(c.box, c.color);
+                break;
+            case DisplayList::Op::Line:
+                r.drawLine(c.box.x, c.box.y, c.box.w, c.box.h, c.color);
+                break;
+            case DisplayList::Op::Text:
+                r.drawText(c.box, c.text->text, *c.text->font, c.color, c.text->fmt, c.text->layout.get());
+                break;
+            default:
+                break;
+            }
+            r.popClip();
+        }
+    }
+};
@@ -1,75 +1,39 @@
 #pragma once
 #include <string>
-#include <windows.h>
-#include <cmath>
+#include "../core/renderer.hpp"
 
 class TextStyle {
 public:
-    std::wstring fontName = L"Segoe UI";
-    double fontSizePt = 9.0;
-    int fontWeight = FW_NORMAL;
-    bool italic = false;
-    bool underline = false;
-    bool strike = false;
-    COLORREF textColor = RGB(0, 0, 0);
-    COLORREF bgColor = RGB(255, 255, 255);
+    Color textColor = Color::rgb(0, 0, 0);
+    Color bgColor = Color::rgb(255, 255, 255);
     bool transparentBg = true;
 
 private:
-    HFONT hFont = nullptr;
+    FontRef font = defaultFont();   // interned: copies of a style share the font
 
 public:
-    TextStyle() { createFont(); }
+    TextStyle() = default;
 
-    TextStyle(const std::wstring& name, double pt = 9.0)
-        : fontName(name), fontSizePt(pt)
-    {
-        createFont();
+    TextStyle(const std::wstring& name, double pt = 9.0) {
+        FontDesc f;
+        f.name = name;
+        f.sizePt = pt;
+        font = internFont(f);
     }
 
-    ~TextStyle() {
-        if (hFont) DeleteObject(hFont);
-    }
-
-    HFONT getFont() const { return hFont; }
+    // font is resolved by the renderer backend (GDI, software...)
+    const FontDesc& getFont() const { return *font; }
+    const FontRef& getFontRef() const { return font; }
 
-    void setFontName(const std::wstring& name) { fontName = name; recreateFont(); }
-    void setFontSize(double pt) { fontSizePt = pt; recreateFont(); }
-    void setBold(bool on) { fontWeight = on ? FW_BOLD : FW_NORMAL; recreateFont(); }
-    void setItalic(bool on) { italic = on; recreateFont(); }
-    void setUnderline(bool on) { underline = on; recreateFont(); }
-    void setStrike(bool on) { strike = on; recreateFont(); }
+    void setFont(const FontDesc& f) { font = internFont(f); }
+    void setFontName(const std::wstring& name) { FontDesc f = *font; f.name = name; setFont(f); }
+    void setFontSize(double pt) { FontDesc f = *font; f.sizePt = pt; setFont(f); }
+    void setBold(bool on) { FontDesc f = *font; f.weight = on ? FONT_WEIGHT_BOLD : FONT_WEIGHT_NORMAL; setFont(f); }
+    void setItalic(bool on) { FontDesc f = *font; f.italic = on; setFont(f); }
+    void setUnderline(bool on) { FontDesc f = *font; f.underline = on; setFont(f); }
+    void setStrike(bool on) { FontDesc f = *font; f.strike = on; setFont(f); }
 
-    void setTextColor(COLORREF c) { textColor = c; }
-    void setBgColor(COLORREF c) { bgColor = c; transparentBg = false; }
+    void setTextColor(Color c) { textColor = c; }
+    void setBgColor(Color c) { bgColor = c; transparentBg = false; }
     void setTransparentBg(bool t) { transparentBg = t; }
-
-private:
-    void createFont() {
-        if (hFont) { DeleteObject(hFont); hFont = nullptr; }
-
-        HDC screen = GetDC(nullptr);
-        int logpixely = GetDeviceCaps(screen, LOGPIXELSY);
-        ReleaseDC(nullptr, screen);
-
-        int height = -MulDiv((int)std::round(fontSizePt), logpixely, 72);
-
-        hFont = CreateFontW(
-            height, 0, 0, 0,
-            fontWeight,
-            italic ? TRUE : FALSE,
-            underline ? TRUE : FALSE,
-            strike ? TRUE : FALSE,
-            DEFAULT_CHARSET,
-            OUT_DEFAULT_PRECIS,
-            CLIP_DEFAULT_PRECIS,
-            CLEARTYPE_QUALITY,
-            DEFAULT_PITCH | FF_DONTCARE,
-            fontName.c_str()
-        );
-    }
-
-    void recreateFont() {
-        createFont();
-    }
 };
@@ -28,6 +28,20 @@ public:
     ~TextBox() override {
         if (hFont) DeleteObject(hFont);
     }
+    // clone(): same settings, its own font handle
+    TextBox(const TextBox& o)
+        : Widget(o), text(o.text), padding(o.padding), fontName(o.fontName), fontSizePt(o.fontSizePt),
+          fontWeight(o.fontWeight), italic(o.italic), underline(o.underline), strike(o.strike),
+          textColor(o.textColor), bgColor(o.bgColor), transparentBg(o.transparentBg)
+    {
+        createFont();
+    }
+    TextBox& operator=(const TextBox&) = delete;
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<TextBox>(*this); }
+
+public:
 
     // --- Setters that recreate font when needed ---
     void setFontName(const std::wstring& name) {
@@ -0,0 +1,601 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "UiFormat.hpp"
+#include "../../core/renderer.hpp"
+#include "../layout/GridLayout.hpp"
+
+// -------------------------------
+// UiCompiler: text description -> binary UI file (UiFormat.hpp).
+//
+//   // comment
+//   style title { font="Segoe UI" size=14 bold color=#202020 }
+//
+//   Panel layout=dock background=#f0f0f0 {
+//       Label dock=top text="Trạng thái" style=title
+//       Panel dock=fill layout=grid columns="auto 1* 120" rows=2 spacing=4 {
+//           Label text="Áp suất" row=0 col=0
+//           Label text="12.5 bar" row=0 col=1 textAlign=right
+//       }
+//   }
+//
+// A node is a widget type (capitalized) followed by properties and an
+// optional { children } block; a property is name=value, or a bare name for
+// true. Values: numbers, "strings" (UTF-8, \" \\ \n \t \uXXXX escapes),
+// #rrggbb / #rrggbbaa colors and keywords. Exactly one root node.
+struct UiCompileResult {
+    std::vector<uint8_t> bytes;   // empty on error
+    std::string error;
+    int line = 0;                 // of the error
+
+    bool ok() const { return error.empty(); }
+};
+
+class UiCompiler {
+public:
+    // wcharSize: sizeof(wchar_t) of the platform that loads the file
+    static UiCompileResult compile(std::string_view source, uint16_t wcharSize = sizeof(wchar_t)) {
+        UiCompiler c(source, wcharSize);
+        UiCompileResult r;
+        if (!c.run()) {
+            r.error = c.err;
+            r.line = c.errLine;
+            return r;
+        }
+        r.bytes = c.write();
+        return r;
+    }
+
+    // reads in, writes out; false with a "file:line: message" error
+    static bool compileFile(const char* in, const char* out, std::string* error = nullptr,
+                            uint16_t wcharSize = sizeof(wchar_t)) {
+        auto fail = [&](const std::string& msg) {
+            if (error) *error = msg;
+            return false;
+        };
+        std::string text;
+        if (FILE* f = std::fopen(in, "rb")) {
+            char buf[1 << 16];
+            for (size_t n; (n = std::fread(buf, 1, sizeof buf, f)) > 0;) text.append(buf, n);
+            std::fclose(f);
+        } else {
+            return fail(std::string(in) + ": cannot open");
+        }
+        UiCompileResult r = compile(text, wcharSize);
+        if (!r.ok()) return fail(std::string(in) + ":" + std::to_string(r.line) + ": " + r.error);
+        FILE* f = std::fopen(out, "wb");
+        if (!f) return fail(std::string(out) + ": cannot create");
+        bool written = std::fwrite(r.bytes.data(), 1, r.bytes.size(), f) == r.bytes.size();
+        if (std::fclose(f) != 0 || !written) return fail(std::string(out) + ": write failed");
+        return true;
+    }
+
+private:
+    enum class Tok { End, Ident, Number, String, Color, Eq, Open, Close, Bad };
+    struct Token {
+        Tok kind = Tok::End;
+        std::string text;   // ident / string (UTF-8) / bad char
+        double number = 0;
+        uint32_t color = 0;
+        int line = 1;
+    };
+
+    struct StyleDesc {
+        std::string font = "Segoe UI";
+        double size = 9.0;
+        bool bold = false, italic = false, underline = false, strike = false;
+        uint32_t color = Color::rgb(0, 0, 0).packed();
+        uint32_t background = Color::rgb(255, 255, 255).packed();
+        bool hasBackground = false;
+
+        std::string key() const {
+            char buf[96];
+            std::snprintf(buf, sizeof buf, "|%g|%d%d%d%d|%08x|%08x|%d", size, bold, italic, underline, strike, color,
+                          background, hasBackground);
+            return font + buf;
+        }
+    };
+
+    std::string_view src;
+    size_t pos = 0;
+    int line = 1;
+    Token tok;
+    uint16_t wcharSize;
+    std::string err;
+    int errLine = 0;
+
+    std::vector<ui_format::Node> nodes;
+    std::vector<ui_format::Style> styles;
+    std::vector<ui_format::Track> tracks;
+    std::vector<uint32_t> types;
+    std::vector<uint8_t> strings;
+    std::unordered_map<std::string, uint32_t> stringIds, typeIds, styleIds;
+    std::map<std::string, StyleDesc> namedStyles;
+
+    UiCompiler(std::string_view s, uint16_t wsize) : src(s), wcharSize(wsize == 2 ? 2 : 4) { next(); }
+
+    bool fail(const std::string& msg) {
+        if (err.empty()) {
+            err = msg;
+            errLine = tok.line;
+        }
+        return false;
+    }
+
+    // ---- lexer ----
+    void next() {
+        for (;;) {
+            while (pos < src.size() && std::strchr(" \t\r\n", src[pos])) line += src[pos++] == '\n';
+            if (pos + 1 < src.size() && src[pos] == '/' && src[pos + 1] == '/') {
+                while (pos < src.size() && src[pos] != '\n') ++pos;
+                continue;
+            }
+            break;
+        }
+        tok = Token{};
+        tok.line = line;
+        if (pos >= src.size()) return;
+        char c = src[pos];
+        auto isIdent = [](char ch, bool first) {
+            return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' || (!first && ch >= '0' && ch <= '9');
+        };
+        if (isIdent(c, true)) {
+            size_t b = pos;
+            while (pos < src.size() && isIdent(src[pos], false)) ++pos;
+            tok.kind = Tok::Ident;
+            tok.text = std::string(src.substr(b, pos - b));
+        } else if ((c >= '0' && c <= '9') || c == '-' || c == '.') {
+            size_t b = pos++;
+            while (pos < src.size() && ((src[pos] >= '0' && src[pos] <= '9') || src[pos] == '.')) ++pos;
+            tok.kind = Tok::Number;
+            tok.number = std::strtod(std::string(src.substr(b, pos - b)).c_str(), nullptr);
+        } else if (c == '#') {
+            size_t b = ++pos;
+            while (pos < src.size() && std::isxdigit((unsigned char)src[pos])) ++pos;
+            std::string hex(src.substr(b, pos - b));
+            if (hex.size() != 6 && hex.size() != 8) {
+                tok.kind = Tok::Bad;
+                tok.text = "#" + hex;
+                return;
+            }
+            uint32_t v = (uint32_t)std::strtoul(hex.c_str(), nullptr, 16);
+            if (hex.size() == 6) v = v << 8 | 0xFF;
+            tok.kind = Tok::Color;
+            tok.color = Color::rgba(v >> 24, (v >> 16) & 0xFF, (v >> 8) & 0xFF, v & 0xFF).packed();
+        } else if (c == '"') {
+            ++pos;
+            tok.kind = Tok::String;
+            while (pos < src.size() && src[pos] != '"') {
+                char ch = src[pos++];
+                if (ch == '\n') ++line;
+                if (ch != '\\' || pos >= src.size()) {
+                    tok.text += ch;
+                    continue;
+                }
+                char e = src[pos++];
+                if (e == 'n') tok.text += '\n';
+                else if (e == 't') tok.text += '\t';
+                else if (e == 'u' && pos + 4 <= src.size()) {
+                    appendUtf8(tok.text, (uint32_t)std::strtoul(std::string(src.substr(pos, 4)).c_str(), nullptr, 16));
+                    pos += 4;
+                } else tok.text += e;
+            }
+            if (pos >= src.size()) {
+                tok.kind = Tok::Bad;
+                tok.text = "unterminated string";
+                return;
+            }
+            ++pos;
+        } else {
+            ++pos;
+            tok.kind = c == '=' ? Tok::Eq : c == '{' ? Tok::Open : c == '}' ? Tok::Close : Tok::Bad;
+            tok.text = std::string(1, c);
+        }
+    }
+
+    static void appendUtf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) out += (char)cp;
+        else if (cp < 0x800) out += { char(0xC0 | cp >> 6), char(0x80 | (cp & 0x3F)) };
+        else if (cp < 0x10000) out += { char(0xE0 | cp >> 12), char(0x80 | ((cp >> 6) & 0x3F)), char(0x80 | (cp & 0x3F)) };
+        else out += { char(0xF0 | cp >> 18), char(0x80 | ((cp >> 12) & 0x3F)), char(0x80 | ((cp >> 6) & 0x3F)), char(0x80 | (cp & 0x3F)) };
+    }
+
+    static bool isType(const Token& t) { return t.kind == Tok::Ident && t.text[0] >= 'A' && t.text[0] <= 'Z'; }
+    // 'style' starts a style block at top level, but 'style=NAME' is a property
+    bool isProperty(const Token& t) const {
+        if (t.kind != Tok::Ident || isType(t)) return false;
+        if (t.text != "style") return true;
+        size_t p = pos;
+        while (p < src.size() && std::strchr(" \t\r\n", src[p])) ++p;
+        return p < src.size() && src[p] == '=';
+    }
+
+    static std::string describe(const Token& t) {
+        if (t.kind == Tok::End) return "end of file";
+        if (t.kind == Tok::Number) return "a number";
+        if (t.kind == Tok::Color) return "a color";
+        return "'" + t.text + "'";
+    }
+
+    // ---- parser ----
+    bool run() {
+        bool haveRoot = false;
+        while (tok.kind != Tok::End) {
+            if (tok.kind == Tok::Ident && tok.text == "style") {
+                if (!parseStyle()) return false;
+            } else if (isType(tok)) {
+                if (haveRoot) return fail("only one root node allowed");
+                haveRoot = true;
+                if (!parseNode(ui_format::NONE)) return false;
+            } else {
+                return fail("expected a widget type or 'style', got " + describe(tok));
+            }
+        }
+        if (!haveRoot) return fail("no root node");
+        return true;
+    }
+
+    struct Value {
+        Token tok;
+        bool bare = false;   // name without =value
+    };
+
+    bool parseProperty(std::string& name, Value& v) {
+        name = tok.text;
+        next();
+        if (tok.kind != Tok::Eq) {
+            v.bare = true;
+            v.tok.kind = Tok::Ident;
+            v.tok.text = "true";
+            return true;
+        }
+        next();
+        if (tok.kind == Tok::End || tok.kind == Tok::Eq || tok.kind == Tok::Open || tok.kind == Tok::Close || tok.kind == Tok::Bad)
+            return fail("missing value for '" + name + "'");
+        v.tok = tok;
+        next();
+        return true;
+    }
+
+    bool parseStyle() {
+        next();
+        if (tok.kind != Tok::Ident) return fail("expected a style name");
+        std::string name = tok.text;
+        next();
+        if (tok.kind != Tok::Open) return fail("expected '{' after style " + name);
+        next();
+        StyleDesc s;
+        while (tok.kind == Tok::Ident) {
+            std::string prop;
+            Value v;
+            if (!parseProperty(prop, v)) return false;
+            bool known = false;
+            if (!styleProperty(s, prop, v, known)) return false;
+            if (!known) return fail("unknown style property '" + prop + "'");
+        }
+        if (tok.kind != Tok::Close) return fail("expected '}' to close style " + name);
+        next();
+        namedStyles[name] = s;
+        return true;
+    }
+
+    bool number(const std::string& prop, const Value& v, double& out) {
+        if (v.tok.kind != Tok::Number) return fail("'" + prop + "' expects a number");
+        out = v.tok.number;
+        return true;
+    }
+
+    // a number the loader accepts as a size (ui_format::validLength)
+    bool length(const std::string& prop, const Value& v, double& out) {
+        if (!number(prop, v, out)) return false;
+        if (!ui_format::validLength(out))
+            return fail("'" + prop + "' must be between 0 and " + std::to_string((long)ui_format::MAX_LENGTH));
+        return true;
+    }
+
+    bool boolean(const std::string& prop, const Value& v, bool& out) {
+        if (v.tok.kind == Tok::Ident && (v.tok.text == "true" || v.tok.text == "false")) out = v.tok.text == "true";
+        else if (v.tok.kind == Tok::Number) out = v.tok.number != 0;
+        else return fail("'" + prop + "' expects true or false");
+        return true;
+    }
+
+    bool color(const std::string& prop, const Value& v, uint32_t& out) {
+        if (v.tok.kind != Tok::Color) return fail("'" + prop + "' expects #rrggbb or #rrggbbaa");
+        out = v.tok.color;
+        return true;
+    }
+
+    template <size_t N>
+    bool keyword(const std::string& prop, const Value& v, const char* const (&names)[N], int& out) {
+        for (size_t i = 0; i < N; ++i) {
+            if (v.tok.kind == Tok::Ident && v.tok.text == names[i]) {
+                out = (int)i;
+                return true;
+            }
+        }
+        std::string list;
+        for (const char* n : names) list += std::string(list.empty() ? "" : ", ") + n;
+        return fail("'" + prop + "' expects one of: " + list);
+    }
+
+    bool styleProperty(StyleDesc& s, const std::string& prop, const Value& v, bool& known) {
+        known = true;
+        if (prop == "font") {
+            if (v.tok.kind != Tok::String) return fail("'font' expects a string");
+            s.font = v.tok.text;
+            return true;
+        }
+        if (prop == "size") return number(prop, v, s.size);
+        if (prop == "bold") return boolean(prop, v, s.bold);
+        if (prop == "italic") return boolean(prop, v, s.italic);
+        if (prop == "underline") return boolean(prop, v, s.underline);
+        if (prop == "strike") return boolean(prop, v, s.strike);
+        if (prop == "color") return color(prop, v, s.color);
+        if (prop == "background") {
+            s.hasBackground = true;
+            return color(prop, v, s.background);
+        }
+        known = false;
+        return true;
+    }
+
+    bool parseNode(uint32_t parent) {
+        using namespace ui_format;
+        size_t index = nodes.size();
+        std::string type = tok.text;
+        next();
+
+        Node n{};
+        n.type = (uint16_t)typeId(type);
+        n.text = n.style = NONE;
+        n.rowSpan = n.colSpan = 1;
+        bool isLabel = type == "Label";
+        StyleDesc style;
+        bool styled = false, hasW = false, hasH = false;
+        std::string columns, rows;
+
+        while (isProperty(tok)) {
+            std::string prop;
+            Value v;
+            if (!parseProperty(prop, v)) return false;
+            double d = 0;
+            bool b = false, known = false;
+            int k = 0;
+
+            if (isLabel && prop != "style") {
+                if (!styleProperty(style, prop, v, known)) return false;
+                if (known) {
+                    styled = true;
+                    continue;
+                }
+            }
+            if (prop == "style") {
+                auto it = v.tok.kind == Tok::Ident ? namedStyles.find(v.tok.text) : namedStyles.end();
+                if (it == namedStyles.end()) return fail("unknown style '" + v.tok.text + "'");
+                style = it->second;
+                styled = true;
+            } else if (prop == "text") {
+                if (v.tok.kind != Tok::String) return fail("'text' expects a string");
+                n.text = stringId(v.tok.text);
+            } else if (prop == "x" || prop == "y") {
+                if (!number(prop, v, d)) return false;
+                (prop == "x" ? n.x : n.y) = (float)d;
+                n.flags |= NODE_POSITION;
+            } else if (prop == "width" || prop == "height") {
+                if (!length(prop, v, d)) return false;
+                (prop == "width" ? n.w : n.h) = (float)d;
+                (prop == "width" ? hasW : hasH) = true;
+            } else if (prop == "visible" || prop == "hidden") {
+                if (!boolean(prop, v, b)) return false;
+                if (b == (prop == "hidden")) n.flags |= NODE_HIDDEN;
+            } else if (prop == "focusable") {
+                if (!boolean(prop, v, b)) return false;
+                if (b) n.flags |= NODE_FOCUSABLE;
+            } else if (prop == "background") {
+                if (!color(prop, v, n.background)) return false;
+                n.flags |= NODE_BACKGROUND;
+            } else if (prop == "layout") {
+                static const char* const kinds[] = { "none", "stack", "grid", "flow", "dock", "absolute" };
+                if (!keyword(prop, v, kinds, k)) return false;
+                n.layout = (LayoutKind)k;
+            } else if (prop == "orientation") {
+                static const char* const o[] = { "vertical", "horizontal" };
+                if (!keyword(prop, v, o, k)) return false;
+                if (k) n.flags |= NODE_HORIZONTAL;
+            } else if (prop == "spacing" || prop == "padding" || prop == "lineSpacing") {
+                if (!length(prop, v, d)) return false;
+                if (prop == "spacing") n.spacing = (float)d, n.flags |= NODE_SPACING;
+                else if (prop == "padding") n.padding = (float)d, n.flags |= NODE_PADDING;
+                else n.lineSpacing = (float)d, n.flags |= NODE_LINE_SPACING;
+            } else if (prop == "align") {
+                static const char* const a[] = { "start", "center", "end", "stretch" };
+                if (!keyword(prop, v, a, k)) return false;
+                n.align = (uint8_t)((n.align & 0x0F) | (k + 1) << 4);
+            } else if (prop == "flowWrap") {
+                if (!boolean(prop, v, b)) return false;
+                if (!b) n.flags |= NODE_FLOW_NOWRAP;
+            } else if (prop == "columns" || prop == "rows") {
+                std::string& defs = prop == "columns" ? columns : rows;
+                if (v.tok.kind == Tok::Number && v.tok.number >= 1) defs = std::to_string((int)v.tok.number);
+                else if (v.tok.kind == Tok::String) defs = "\"" + v.tok.text;
+                else return fail("'" + prop + "' expects a count or a track list like \"auto 1* 120\"");
+            } else if (prop == "row" || prop == "col" || prop == "rowSpan" || prop == "colSpan") {
+                if (!number(prop, v, d) || d < 0 || d > 65535) return fail("'" + prop + "' expects a cell index");
+                if (prop == "row") n.row = (uint16_t)d;
+                else if (prop == "col") n.col = (uint16_t)d;
+                else if (prop == "rowSpan") n.rowSpan = (uint8_t)std::clamp(d, 1.0, 255.0);
+                else n.colSpan = (uint8_t)std::clamp(d, 1.0, 255.0);
+                n.flags |= NODE_CELL;
+            } else if (prop == "dock") {
+                static const char* const docks[] = { "left", "top", "right", "bottom", "fill" };
+                if (!keyword(prop, v, docks, k)) return false;
+                n.dock = (uint8_t)k;
+            } else if (prop == "textAlign") {
+                static const char* const a[] = { "left", "center", "right" };
+                if (!keyword(prop, v, a, k)) return false;
+                n.align = (uint8_t)((n.align & ~0x3) | k);
+            } else if (prop == "verticalAlign") {
+                static const char* const a[] = { "top", "middle", "bottom" };
+                if (!keyword(prop, v, a, k)) return false;
+                n.align = (uint8_t)((n.align & ~0xC) | k << 2);
+            } else if (prop == "wrap" || prop == "ellipsize") {
+                if (!boolean(prop, v, b)) return false;
+                if (b) n.flags |= prop == "wrap" ? NODE_WRAP : NODE_ELLIPSIZE;
+            } else if (prop == "maxLines") {
+                if (!number(prop, v, d)) return false;
+                n.maxLines = (int16_t)std::clamp(d, 0.0, 32767.0);
+            } else {
+                return fail("unknown property '" + prop + "' on " + type);
+            }
+        }
+        if (hasW != hasH) return fail("width and height must be given together");
+        if (hasW) n.flags |= NODE_FIXED_SIZE;
+        if (styled) n.style = styleId(style);
+        if (!gridTracks(n, columns, true) || !gridTracks(n, rows, false)) return false;
+
+        nodes.push_back(n);
+        if (parent != NONE) ++nodes[parent].childCount;
+        if (tok.kind == Tok::Open) {
+            next();
+            while (isType(tok)) {
+                if (!parseNode((uint32_t)index)) return false;
+            }
+            if (tok.kind != Tok::Close) return fail("expected a child widget or '}', got " + describe(tok));
+            next();
+        }
+        if (tok.kind == Tok::Bad) return fail("unexpected '" + tok.text + "'");
+        return true;
+    }
+
+    // "N" -> count only; "\"auto 1* 120" -> track definitions
+    bool gridTracks(ui_format::Node& n, const std::string& defs, bool columns) {
+        if (defs.empty()) return true;
+        uint16_t& count = columns ? n.columns : n.rows;
+        if (defs[0] != '"') {
+            count = (uint16_t)std::min(65535, std::stoi(defs));
+            return true;
+        }
+        std::vector<ui_format::Track> list;
+        size_t i = 1;
+        while (i < defs.size()) {
+            while (i < defs.size() && defs[i] == ' ') ++i;
+            size_t b = i;
+            while (i < defs.size() && defs[i] != ' ') ++i;
+            if (b == i) break;
+            std::string t = defs.substr(b, i - b);
+            ui_format::Track tr{};
+            if (t == "auto") {
+                tr.unit = (uint8_t)GridLength::Unit::Auto;
+            } else if (t.back() == '*') {
+                tr.unit = (uint8_t)GridLength::Unit::Star;
+                tr.value = t.size() == 1 ? 1.0f : std::strtof(t.c_str(), nullptr);
+            } else {
+                char* end = nullptr;
+                tr.unit = (uint8_t)GridLength::Unit::Fixed;
+                tr.value = std::strtof(t.c_str(), &end);
+                if (*end) return fail("bad grid track '" + t + "' (use auto, N*, or a pixel size)");
+            }
+            list.push_back(tr);
+        }
+        if (list.empty()) return fail(std::string("empty ") + (columns ? "columns" : "rows"));
+        // columns are added first, so row tracks follow the column tracks
+        if (columns || !(n.flags & ui_format::NODE_COLUMN_TRACKS)) n.tracks = (uint32_t)tracks.size();
+        tracks.insert(tracks.end(), list.begin(), list.end());
+        count = (uint16_t)list.size();
+        n.flags |= columns ? ui_format::NODE_COLUMN_TRACKS : ui_format::NODE_ROW_TRACKS;
+        return true;
+    }
+
+    // ---- tables ----
+    uint32_t stringId(const std::string& utf8) {
+        auto it = stringIds.find(utf8);
+        if (it != stringIds.end()) return it->second;
+        std::vector<uint32_t> units;
+        for (size_t i = 0; i < utf8.size();) {
+            uint32_t cp = (unsigned char)utf8[i];
+            int extra = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+            if (extra) cp &= 0x3F >> extra;
+            ++i;
+            for (int k = 0; k < extra && i < utf8.size(); ++k, ++i) cp = cp << 6 | ((unsigned char)utf8[i] & 0x3F);
+            if (wcharSize == 2 && cp >= 0x10000) {
+                units.push_back(0xD800 + ((cp - 0x10000) >> 10));
+                units.push_back(0xDC00 + ((cp - 0x10000) & 0x3FF));
+            } else {
+                units.push_back(cp);
+            }
+        }
+        uint32_t id = (uint32_t)strings.size();
+        auto put = [&](uint32_t v, size_t bytes) {
+            for (size_t b = 0; b < bytes; ++b) strings.push_back((uint8_t)(v >> (8 * b)));
+        };
+        put((uint32_t)units.size(), 4);
+        for (uint32_t u : units) put(u, wcharSize);
+        put(0, wcharSize);
+        while (strings.size() % 4) strings.push_back(0);
+        stringIds.emplace(utf8, id);
+        return id;
+    }
+
+    uint32_t typeId(const std::string& name) {
+        auto it = typeIds.find(name);
+        if (it != typeIds.end()) return it->second;
+        uint32_t id = (uint32_t)types.size();
+        types.push_back(stringId(name));
+        typeIds.emplace(name, id);
+        return id;
+    }
+
+    uint32_t styleId(const StyleDesc& s) {
+        std::string key = s.key();
+        auto it = styleIds.find(key);
+        if (it != styleIds.end()) return it->second;
+        ui_format::Style st{};
+        st.fontName = stringId(s.font);
+        st.sizePt = (float)s.size;
+        st.weight = (uint16_t)(s.bold ? FONT_WEIGHT_BOLD : FONT_WEIGHT_NORMAL);
+        st.flags = (uint8_t)((s.italic ? ui_format::STYLE_ITALIC : 0) | (s.underline ? ui_format::STYLE_UNDERLINE : 0)
+                             | (s.strike ? ui_format::STYLE_STRIKE : 0) | (s.hasBackground ? ui_format::STYLE_BACKGROUND : 0));
+        st.textColor = s.color;
+        st.bgColor = s.background;
+        uint32_t id = (uint32_t)styles.size();
+        styles.push_back(st);
+        styleIds.emplace(key, id);
+        return id;
+    }
+
+    std::vector<uint8_t> write() const {
+        using namespace ui_format;
+        std::vector<uint8_t> out(sizeof(Header));
+        auto append = [&](const void* p, size_t bytes) {
+            const uint8_t* b = (const uint8_t*)p;
+            out.insert(out.end(), b, b + bytes);
+            while (out.size() % 4) out.push_back(0);
+        };
+        Header h{};
+        std::memcpy(h.magic, MAGIC, 4);
+        h.version = VERSION;
+        h.wcharSize = wcharSize;
+        h.nodes = { (uint32_t)out.size(), (uint32_t)nodes.size() };
+        append(nodes.data(), nodes.size() * sizeof(Node));
+        h.styles = { (uint32_t)out.size(), (uint32_t)styles.size() };
+        append(styles.data(), styles.size() * sizeof(Style));
+        h.tracks = { (uint32_t)out.size(), (uint32_t)tracks.size() };
+        append(tracks.data(), tracks.size() * sizeof(Track));
+        h.types = { (uint32_t)out.size(), (uint32_t)types.size() };
+        append(types.data(), types.size() * sizeof(uint32_t));
+        h.strings = { (uint32_t)out.size(), (uint32_t)strings.size() };
+        append(strings.data(), strings.size());
+        h.fileSize = (uint32_t)out.size();
+        std::memcpy(out.data(), &h, sizeof h);
+        return out;
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+
+// -------------------------------
+// Binary UI description ("WUI1"): flat little-endian tables a loader maps
+// and walks once (UiLoader.hpp); produced from text by UiCompiler.hpp.
+//
+//   Header | nodes[] | styles[] | tracks[] | types[] | strings
+//
+// Nodes are in pre-order, each followed by its childCount direct children,
+// so the tree is rebuilt in one pass with a stack. Every table is 4-byte
+// aligned; offsets are from the start of the file. A string is a uint32
+// length followed by that many wchar_t (of header.wcharSize bytes) and a 0,
+// referenced by its offset into the string area.
+namespace ui_format {
+
+constexpr char MAGIC[4] = { 'W', 'U', 'I', '1' };
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+// w, h, spacing, padding and lineSpacing lie in [0, MAX_LENGTH] (no NaN/inf)
+constexpr float MAX_LENGTH = 1 << 20;
+inline bool validLength(double v) { return v >= 0 && v <= MAX_LENGTH; }
+
+struct Table {
+    uint32_t offset;
+    uint32_t count;
+};
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSize;
+    uint16_t wcharSize;       // sizeof(wchar_t) of the strings: 2 (Windows) or 4
+    uint16_t reserved;
+    Table nodes;              // Node
+    Table styles;             // Style
+    Table tracks;             // Track
+    Table types;              // uint32_t string: widget type name
+    Table strings;            // offset, size in bytes
+};
+
+enum class LayoutKind : uint8_t { None, Stack, Grid, Flow, Dock, Absolute };
+
+enum NodeFlags : uint32_t {
+    NODE_HIDDEN = 1u << 0,
+    NODE_FOCUSABLE = 1u << 1,
+    NODE_FIXED_SIZE = 1u << 2,      // w, h
+    NODE_POSITION = 1u << 3,        // x, y (absolute layout parents)
+    NODE_BACKGROUND = 1u << 4,      // background
+    NODE_HORIZONTAL = 1u << 5,      // stack orientation
+    NODE_FLOW_NOWRAP = 1u << 6,
+    NODE_COLUMN_TRACKS = 1u << 7,   // columns: track definitions, not just a count
+    NODE_ROW_TRACKS = 1u << 8,
+    NODE_CELL = 1u << 9,            // row, col, rowSpan, colSpan in a grid parent
+    NODE_WRAP = 1u << 10,           // label
+    NODE_ELLIPSIZE = 1u << 11,
+    NODE_PADDING = 1u << 12,        // padding given (layout, else label)
+    NODE_SPACING = 1u << 13,
+    NODE_LINE_SPACING = 1u << 14,
+};
+
+struct Node {
+    uint16_t type;            // types[type]
+    LayoutKind layout;
+    uint8_t dock;             // Dock, when the parent has a dock layout
+    uint32_t flags;           // NodeFlags
+    uint32_t childCount;
+    uint32_t text;            // string or NONE
+    uint32_t style;           // styles[style] or NONE
+    uint32_t background;      // Color::packed()
+    float x, y, w, h;
+    float spacing, padding, lineSpacing;
+    uint32_t tracks;          // first column track; row tracks follow
+    uint16_t columns, rows;   // grid size (track count when defined)
+    uint16_t row, col;        // grid cell
+    uint8_t rowSpan, colSpan;
+    uint8_t align;            // label: hAlign | vAlign << 2; stack: crossAlign << 4
+    uint8_t reserved;
+    int16_t maxLines;
+    uint16_t reserved2;
+};
+static_assert(sizeof(Node) == 72, "ui_format::Node layout");
+
+enum StyleFlags : uint8_t { STYLE_ITALIC = 1, STYLE_UNDERLINE = 2, STYLE_STRIKE = 4, STYLE_BACKGROUND = 8 };
+
+struct Style {
+    uint32_t fontName;        // string
+    float sizePt;
+    uint16_t weight;
+    uint8_t flags;            // StyleFlags
+    uint8_t reserved;
+    uint32_t textColor;
+    uint32_t bgColor;
+};
+static_assert(sizeof(Style) == 20, "ui_format::Style layout");
+
+struct Track {
+    uint8_t unit;             // GridLength::Unit
+    uint8_t reserved[3];
+    float value;
+};
+static_assert(sizeof(Track) == 8, "ui_format::Track layout");
+
+} // namespace ui_format
@@ -0,0 +1,385 @@
+#pragma once
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include "UiFormat.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/cow.hpp"
+#include "../layoutColections.hpp"
+#include "../widget/label.hpp"
+#include "../widget/Panel.hpp"
+
+// -------------------------------
+// MappedFile: read-only memory map of a whole file.
+class MappedFile {
+    const uint8_t* ptr = nullptr;
+    size_t bytes = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const char* path) {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) return close(), false;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) return close(), false;
+        ptr = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!ptr) return close(), false;
+        bytes = (size_t)size.QuadPart;
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // the mapping keeps the file
+        if (p == MAP_FAILED) return false;
+        ptr = (const uint8_t*)p;
+        bytes = (size_t)st.st_size;
+#endif
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (ptr) UnmapViewOfFile(ptr);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (ptr) munmap((void*)ptr, bytes);
+#endif
+        ptr = nullptr;
+        bytes = 0;
+    }
+
+    const uint8_t* data() const { return ptr; }
+    size_t size() const { return bytes; }
+};
+
+class UiFile;
+
+// widget type name -> factory; the loader applies the common properties
+// (visibility, focus, position, size, layout) to whatever the factory returns
+using UiFactory = std::function<std::unique_ptr<Widget>(const UiFile&, const ui_format::Node&)>;
+
+class UiTypeRegistry {
+    std::unordered_map<std::string, UiFactory> factories;
+
+public:
+    UiTypeRegistry();
+
+    void add(const std::string& name, UiFactory f) { factories[name] = std::move(f); }
+    const UiFactory* find(std::string_view name) const {
+        auto it = factories.find(std::string(name));
+        return it == factories.end() ? nullptr : &it->second;
+    }
+};
+
+inline UiTypeRegistry& uiTypes() {
+    static UiTypeRegistry r;
+    return r;
+}
+
+// -------------------------------
+// UiFile: a binary UI file (UiFormat.hpp), mapped or in memory. open() only
+// checks the header and table bounds; build() walks the pre-order node table
+// once, creating each widget and attaching it to its parent. Text is copied
+// straight out of the mapping (no decoding), styles are resolved once per
+// build and shared by every label using them.
+class UiFile {
+    MappedFile mapped;
+    const uint8_t* base = nullptr;
+    size_t bytes = 0;
+    const ui_format::Header* header = nullptr;
+    std::string err;
+    std::vector<Cow<TextStyle>> resolved;   // per style, for the current build
+
+public:
+    bool open(const char* path) {
+        if (!mapped.open(path)) return fail(std::string(path) + ": cannot map");
+        return attach(mapped.data(), mapped.size());
+    }
+
+    // data must outlive the UiFile
+    bool openMemory(const void* data, size_t size) {
+        mapped.close();
+        return attach((const uint8_t*)data, size);
+    }
+
+    const std::string& error() const { return err; }
+    bool isOpen() const { return header != nullptr; }
+    size_t nodeCount() const { return header ? header->nodes.count : 0; }
+
+    // nullptr (see error()) when the file is corrupt or uses an unknown type
+    std::unique_ptr<Widget> build(const UiTypeRegistry& types = uiTypes()) {
+        using namespace ui_format;
+        if (!header) return fail("no file open"), nullptr;
+        if (header->nodes.count == 0) return fail("no nodes"), nullptr;
+
+        std::vector<const UiFactory*> factories(header->types.count);
+        const uint32_t* typeNames = table<uint32_t>(header->types);
+        for (uint32_t i = 0; i < header->types.count; ++i) {
+            std::string name = narrow(string(typeNames[i]));
+            factories[i] = types.find(name);
+            if (!factories[i]) return fail("unknown widget type '" + name + "'"), nullptr;
+        }
+        resolveStyles();
+
+        struct Open {
+            Widget* w;
+            const Node* node;
+            uint32_t remaining;   // children still to come
+        };
+        std::vector<Open> stack;
+        std::unique_ptr<Widget> root;
+        const Node* nodes = table<Node>(header->nodes);
+        for (uint32_t i = 0; i < header->nodes.count; ++i) {
+            const Node& n = nodes[i];
+            if (n.type >= header->types.count || (n.text != NONE && !validString(n.text))
+                || (n.style != NONE && n.style >= header->styles.count)
+                || (uint64_t)n.tracks + trackCount(n) > header->tracks.count || !validLengths(n))
+                return fail("node " + std::to_string(i) + " is corrupt"), nullptr;
+            if (i > 0 && stack.empty()) return fail("more than one root node"), nullptr;
+
+            std::unique_ptr<Widget> w = (*factories[n.type])(*this, n);
+            if (!w) return fail("factory failed for node " + std::to_string(i)), nullptr;
+            applyCommon(*w, n);
+            Widget* raw = w.get();
+            if (stack.empty()) {
+                root = std::move(w);
+            } else {
+                Open& parent = stack.back();
+                parent.w->addChild(std::move(w));
+                placeInParent(*parent.w, *parent.node, raw, n);
+                if (--parent.remaining == 0) stack.pop_back();
+                while (!stack.empty() && stack.back().remaining == 0) stack.pop_back();
+            }
+            if (n.childCount) stack.push_back({ raw, &n, n.childCount });
+        }
+        resolved.clear();
+        if (!stack.empty()) return fail("node table ends inside a subtree"), nullptr;
+        return root;
+    }
+
+    // ---- for factories ----
+
+    // chars in the mapping; empty for NONE
+    std::wstring_view string(uint32_t id) const {
+        if (id == ui_format::NONE || !validString(id)) return {};
+        const uint8_t* p = base + header->strings.offset + id;
+        uint32_t len;
+        std::memcpy(&len, p, 4);
+        return { (const wchar_t*)(p + 4), len };
+    }
+
+    // style shared by every label of this build; default style for NONE
+    Cow<TextStyle> style(uint32_t id) const {
+        return id < resolved.size() ? resolved[id] : Cow<TextStyle>();
+    }
+
+private:
+    bool fail(const std::string& msg) {
+        err = msg;
+        return false;
+    }
+
+    template <typename T>
+    const T* table(const ui_format::Table& t) const { return (const T*)(base + t.offset); }
+
+    bool tableFits(const ui_format::Table& t, size_t elem) const {
+        return t.offset % 4 == 0 && (uint64_t)t.offset + (uint64_t)t.count * elem <= bytes;
+    }
+
+    bool attach(const uint8_t* data, size_t size) {
+        using namespace ui_format;
+        header = nullptr;
+        err.clear();
+        base = data;
+        bytes = size;
+        const Header* h = (const Header*)data;
+        if (!data || size < sizeof(Header) || std::memcmp(h->magic, MAGIC, 4) != 0) return fail("not a UI file");
+        if (h->version != VERSION) return fail("unsupported UI file version " + std::to_string(h->version));
+        if (h->wcharSize != sizeof(wchar_t))
+            return fail("strings use " + std::to_string(h->wcharSize) + "-byte wchar_t, this build uses "
+                        + std::to_string(sizeof(wchar_t)) + " (recompile with the matching size)");
+        if (h->fileSize != size || !tableFits(h->nodes, sizeof(Node)) || !tableFits(h->styles, sizeof(Style))
+            || !tableFits(h->tracks, sizeof(Track)) || !tableFits(h->types, sizeof(uint32_t)) || !tableFits(h->strings, 1))
+            return fail("UI file is truncated or corrupt");
+        header = h;
+        return true;
+    }
+
+    bool validString(uint32_t id) const {
+        if (id % 4 || (uint64_t)id + 4 > header->strings.count) return false;
+        uint32_t len;
+        std::memcpy(&len, base + header->strings.offset + id, 4);
+        return (uint64_t)id + 4 + ((uint64_t)len + 1) * sizeof(wchar_t) <= header->strings.count;
+    }
+
+    static std::string narrow(std::wstring_view s) {
+        std::string out;
+        for (wchar_t c : s) out += c < 0x80 ? (char)c : '?';
+        return out;
+    }
+
+    // lengths that are used are in range: they reach ints (label padding) and layout math
+    static bool validLengths(const ui_format::Node& n) {
+        using namespace ui_format;
+        return (!(n.flags & NODE_FIXED_SIZE) || (validLength(n.w) && validLength(n.h)))
+            && (!(n.flags & NODE_SPACING) || validLength(n.spacing))
+            && (!(n.flags & NODE_PADDING) || validLength(n.padding))
+            && (!(n.flags & NODE_LINE_SPACING) || validLength(n.lineSpacing));
+    }
+
+    static uint32_t trackCount(const ui_format::Node& n) {
+        return (n.flags & ui_format::NODE_COLUMN_TRACKS ? n.columns : 0) + (n.flags & ui_format::NODE_ROW_TRACKS ? n.rows : 0);
+    }
+
+    void resolveStyles() {
+        using namespace ui_format;
+        resolved.clear();
+        resolved.reserve(header->styles.count);
+        const Style* styles = table<Style>(header->styles);
+        for (uint32_t i = 0; i < header->styles.count; ++i) {
+            const Style& s = styles[i];
+            TextStyle st;
+            FontDesc f;
+            f.name = std::wstring(string(s.fontName));
+            f.sizePt = s.sizePt;
+            f.weight = s.weight;
+            f.italic = s.flags & STYLE_ITALIC;
+            f.underline = s.flags & STYLE_UNDERLINE;
+            f.strike = s.flags & STYLE_STRIKE;
+            st.setFont(f);
+            st.textColor = unpack(s.textColor);
+            if (s.flags & STYLE_BACKGROUND) st.setBgColor(unpack(s.bgColor));
+            resolved.emplace_back(std::move(st));
+        }
+    }
+
+    static std::vector<GridLength> gridLengths(const ui_format::Track* t, uint32_t n) {
+        std::vector<GridLength> out(n);
+        for (uint32_t i = 0; i < n; ++i) out[i] = { (GridLength::Unit)t[i].unit, t[i].value };
+        return out;
+    }
+
+    void applyCommon(Widget& w, const ui_format::Node& n) const {
+        using namespace ui_format;
+        if (n.flags & NODE_POSITION) {
+            w.rect.x = n.x;
+            w.rect.y = n.y;
+        }
+        if (n.flags & NODE_FIXED_SIZE) w.setFixedSize(n.w, n.h);
+        if (n.flags & NODE_HIDDEN) w.setVisible(false);
+        if (n.flags & NODE_FOCUSABLE) w.setFocusable(true);
+
+        switch (n.layout) {
+        case LayoutKind::None:
+            break;
+        case LayoutKind::Stack: {
+            auto l = std::make_unique<StackLayout>(n.flags & NODE_HORIZONTAL ? Orientation::Horizontal : Orientation::Vertical);
+            if (n.flags & NODE_SPACING) l->spacing = n.spacing;
+            if (n.flags & NODE_PADDING) l->padding = n.padding;
+            if (n.align >> 4) l->crossAlign = (Align)((n.align >> 4) - 1);
+            w.layout = std::move(l);
+            break;
+        }
+        case LayoutKind::Grid: {
+            auto l = std::make_unique<GridLayout>(std::max<int>(1, n.rows), std::max<int>(1, n.columns));
+            const Track* t = table<Track>(header->tracks) + n.tracks;
+            if (n.flags & NODE_COLUMN_TRACKS) {
+                l->setColumns(gridLengths(t, n.columns));
+                t += n.columns;
+            }
+            if (n.flags & NODE_ROW_TRACKS) l->setRows(gridLengths(t, n.rows));
+            if (n.flags & NODE_SPACING) l->spacing = n.spacing;
+            if (n.flags & NODE_PADDING) l->padding = n.padding;
+            w.layout = std::move(l);
+            break;
+        }
+        case LayoutKind::Flow: {
+            auto l = std::make_unique<FlowLayout>();
+            if (n.flags & NODE_SPACING) l->spacing = n.spacing;
+            if (n.flags & NODE_LINE_SPACING) l->lineSpacing = n.lineSpacing;
+            if (n.flags & NODE_PADDING) l->padding = n.padding;
+            l->wrap = !(n.flags & NODE_FLOW_NOWRAP);
+            w.layout = std::move(l);
+            break;
+        }
+        case LayoutKind::Dock:
+            w.layout = std::make_unique<DockLayout>();
+            break;
+        case LayoutKind::Absolute:
+            w.layout = std::make_unique<AbsoluteLayout>();
+            break;
+        }
+        if (w.layout) w.markLayoutDirty();
+    }
+
+    // layouts that keep per-child data
+    static void placeInParent(Widget& parent, const ui_format::Node& pn, Widget* child, const ui_format::Node& n) {
+        using namespace ui_format;
+        if (pn.layout == LayoutKind::Dock) {
+            static_cast<DockLayout*>(parent.layout.get())->addDockedWidget(child, (Dock)std::min<uint8_t>(n.dock, 4));
+        } else if (pn.layout == LayoutKind::Grid && (n.flags & NODE_CELL)) {
+            static_cast<GridLayout*>(parent.layout.get())->place(child, n.row, n.col, n.rowSpan, n.colSpan);
+        }
+    }
+
+    static Color unpack(uint32_t p) {
+        return Color::rgba(p & 0xFF, (p >> 8) & 0xFF, (p >> 16) & 0xFF, p >> 24);
+    }
+
+    friend class UiTypeRegistry;
+};
+
+inline UiTypeRegistry::UiTypeRegistry() {
+    using namespace ui_format;
+    add("Widget", [](const UiFile&, const Node&) { return std::make_unique<Widget>(); });
+    auto panel = [](auto p, const Node& n) {
+        if (n.flags & NODE_BACKGROUND) p->setBackground(UiFile::unpack(n.background));
+        return p;
+    };
+    add("Panel", [panel](const UiFile&, const Node& n) -> std::unique_ptr<Widget> { return panel(std::make_unique<Panel>(), n); });
+    add("ScrollPanel", [panel](const UiFile&, const Node& n) -> std::unique_ptr<Widget> {
+        return panel(std::make_unique<ScrollPanel>(), n);
+    });
+    add("Label", [](const UiFile& f, const Node& n) -> std::unique_ptr<Widget> {
+        auto l = std::make_unique<Label>(std::wstring(f.string(n.text)), f.style(n.style));
+        if (n.align & 0x3) l->setHAlign((Label::HAlign)(n.align & 0x3));
+        if (n.align & 0xC) l->setVAlign((Label::VAlign)((n.align >> 2) & 0x3));
+        if (n.flags & NODE_WRAP) l->setWrap(true);
+        if (n.flags & NODE_ELLIPSIZE) l->setEllipsize(true);
+        if (n.maxLines) l->setMaxLines(n.maxLines);
+        if ((n.flags & NODE_PADDING) && n.layout == LayoutKind::None) l->setPadding((int)n.padding);
+        return l;
+    });
+}
@@ -1,26 +1,77 @@
-#include "../core/widget.hpp"
+#pragma once
+#include <type_traits>
+#include "../../core/widget.hpp"
+#include "../layout/LayoutSlot.hpp"
 
 class Panel : public Widget {
 protected:
-    COLORREF bgColor = RGB(240, 240, 240);
+    Color bgColor = Color::rgb(240, 240, 240);
 public:
     Panel() = default;
-    void setBackground(COLORREF color) { bgColor = color; markDirty(); }
+    void setBackground(Color color) { bgColor = color; markDirty(); }
 
-    void draw(HDC hdc, int ox=0, int oy=0) override {
-        RECT r = {(LONG)(ox + rect.x), (LONG)(oy + rect.y),
-                  (LONG)(ox + rect.x + rect.w), (LONG)(oy + rect.y + rect.h)};
-        HBRUSH brush = CreateSolidBrush(bgColor);
-        FillRect(hdc, &r, brush);
-        DeleteObject(brush);
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<Panel>(*this); }
+public:
+
+    void draw(Renderer& r, int ox=0, int oy=0) override {
+        r.fillRect({(double)(int)(ox + rect.x), (double)(int)(oy + rect.y),
+                    (double)(int)rect.w, (double)(int)rect.h}, bgColor);
 
         // Draw children
-        for (auto &c : children)
-            c->draw(hdc, ox + (int)rect.x, oy + (int)rect.y);
+        drawChildren(r, ox + (int)rect.x, oy + (int)rect.y);
     }
 };
 
-enum class Orientation { Vertical, Horizontal };
+// Panel whose built-in layout (Stack, Grid, Flow, Dock, Absolute) is stored
+// in the widget and dispatched without virtual calls: no separate layout
+// allocation per container. Other layouts are allocated into Widget::layout;
+// assigning Widget::layout directly still works and takes precedence.
+class LayoutPanel : public Panel {
+    LayoutSlot inlineLayout;
+
+public:
+    LayoutPanel() = default;
+
+    template <class L, class... Args>
+    requires std::is_base_of_v<Layout, L>
+    L& setLayout(Args&&... args) {
+        L* l;
+        if constexpr (LayoutSlot::holds<L>) {
+            layout.reset();
+            l = &inlineLayout.emplace<L>(std::forward<Args>(args)...);
+        } else {
+            inlineLayout.reset();
+            auto p = std::make_unique<L>(std::forward<Args>(args)...);
+            l = p.get();
+            layout = std::move(p);
+        }
+        markLayoutDirty();
+        return *l;
+    }
+
+    // the active layout if it is an L
+    template <class L>
+    L* layoutAs() {
+        if (layout) return dynamic_cast<L*>(layout.get());
+        if constexpr (LayoutSlot::holds<L>) return inlineLayout.get<L>();
+        return nullptr;
+    }
+
+    Size measureOverride(const LayoutConstraints& c) const override {
+        if (layout || !inlineLayout) return Panel::measureOverride(c);
+        return meansureSize = const_cast<LayoutSlot&>(inlineLayout).measure(const_cast<LayoutPanel*>(this), c);
+    }
+
+    void arrangeChildren(const Rect& bounds) override {
+        if (layout || !inlineLayout) Panel::arrangeChildren(bounds);
+        else inlineLayout.arrange(this, bounds);
+    }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<LayoutPanel>(*this); }
+    void onCloned(const Widget& proto) override { inlineLayout.remap(proto, *this); }
+};
 
 class StackPanel : public Panel {
     Orientation orientation = Orientation::Vertical;
@@ -28,7 +79,7 @@ class StackPanel : public Panel {
 public:
     StackPanel(Orientation o = Orientation::Vertical) : orientation(o) {}
 
-    void setSpacing(double s) { spacing = s; markDirty(); }
+    void setSpacing(double s) { spacing = s; markLayoutDirty(); markDirty(); }
 
     void updateLayout() {
         double offset = 0;
@@ -41,12 +92,17 @@ public:
                 offset += c->rect.w + spacing;
             }
         }
+        invalidateHitIndex();
     }
 
-    void update(double dt) override {
+    // stack once per arrange (children added, spacing changed...) instead of every tick
+    void arrangeChildren(const Rect& bounds) override {
+        Panel::arrangeChildren(bounds);
         updateLayout();
-        Panel::update(dt);
     }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<StackPanel>(*this); }
 };
 
 class GridPanel : public Panel {
@@ -56,7 +112,7 @@ class GridPanel : public Panel {
 public:
     GridPanel(int r = 1, int c = 1) : rows(r), cols(c) {}
 
-    void setGrid(int r, int c) { rows = r; cols = c; markDirty(); }
+    void setGrid(int r, int c) { rows = r; cols = c; markLayoutDirty(); markDirty(); }
 
     void updateLayout() {
         double cellW = rect.w / cols;
@@ -72,49 +128,61 @@ public:
             c->rect.w = cellW - 2 * padding;
             c->rect.h = cellH - 2 * padding;
         }
+        invalidateHitIndex();
     }
 
-    void update(double dt) override {
-        updateLayout(); 
-        Panel::update(dt);
+    void arrangeChildren(const Rect& bounds) override {
+        Panel::arrangeChildren(bounds);
+        updateLayout();
     }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<GridPanel>(*this); }
 };
 
 class ScrollPanel : public Panel {
+protected:
     double scrollY = 0.0;
     double contentHeight = 0.0;
 public:
-    void scroll(double dy) {
+    double getScrollY() const { return scrollY; }
+    double getContentHeight() const { return contentHeight; }
+
+    virtual void scroll(double dy) {
         scrollY += dy;
         if (scrollY < 0) scrollY = 0;
         if (scrollY > contentHeight - rect.h)
             scrollY = std::max(0.0, contentHeight - rect.h);
+        syncStore();
         markDirty();
     }
 
-    void update(double dt) override {
-        // tính chiều cao nội dung
+    // tính chiều cao nội dung once per arrange instead of every tick
+    void arrangeChildren(const Rect& bounds) override {
+        Panel::arrangeChildren(bounds);
         double maxY = 0;
         for (auto &c : children)
             maxY = std::max(maxY, c->rect.y + c->rect.h);
         contentHeight = maxY;
-        Panel::update(dt);
     }
 
-    void draw(HDC hdc, int ox=0, int oy=0) override {
-        RECT clip = {(LONG)(ox + rect.x), (LONG)(oy + rect.y),
-                     (LONG)(ox + rect.x + rect.w), (LONG)(oy + rect.y + rect.h)};
-        SaveDC(hdc);
-        IntersectClipRect(hdc, clip.left, clip.top, clip.right, clip.bottom);
+    void draw(Renderer& r, int ox=0, int oy=0) override {
+        r.pushClip({(double)(int)(ox + rect.x), (double)(int)(oy + rect.y),
+                    (double)(int)rect.w, (double)(int)rect.h});
 
-        for (auto &c : children)
-            c->draw(hdc, ox + (int)rect.x, oy + (int)(rect.y - scrollY));
+        drawChildren(r, ox + (int)rect.x, oy + (int)rect.y + childOffsetY());
 
-        RestoreDC(hdc, -1);
+        r.popClip();
     }
 
+    int childOffsetY() const override { return -(int)scrollY; }
+    bool clipsChildren() const override { return true; }
+
     void onMouseMove(int, int y) override {
         // ví dụ: cuộn bằng kéo chuột (chưa hoàn chỉnh)
         // có thể thêm xử lý WM_MOUSEWHEEL ở cấp cao hơn
     }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<ScrollPanel>(*this); }
 };
@@ -0,0 +1,236 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include "../../core/widget.hpp"
+#include "../style.hpp"
+
+// -------------------------------
+// Static widget trees: a screen whose shape is fixed at compile time (HUD,
+// status bar) described as nested types. Each node is a plain value, and
+// containers hold their children in a std::tuple. Layout parameters are
+// template arguments, so measure/arrange/draw are ordinary member calls the
+// compiler inlines through the whole tree: no virtual dispatch and no heap
+// node per widget. StaticWidget<Tree> embeds one tree as a single node of a
+// dynamic Widget tree.
+//
+//   namespace st = static_tree;
+//   using Hud = st::Column<4, 6,
+//       st::Text,                                        // title
+//       st::Row<8, 0, st::Text, st::Sized<120, 10, st::Fill>>>;
+//
+//   auto hud = std::make_unique<StaticWidget<Hud>>();
+//   st::at<0>(hud->edit()).setText(L"FPS 60");           // edit() marks layout dirty
+//
+// Node rects are relative to the parent node, like Widget::rect, and are
+// drawn with the same integer rounding, so a static tree paints exactly like
+// the equivalent Widget/StackLayout tree. Static nodes are not hit-tested or
+// focused on their own: events go to the StaticWidget.
+namespace static_tree {
+
+// single-line text, drawn and measured like a non-wrapping Label
+class Text {
+    std::wstring text;
+    TextStyle style;
+    int padding = 2;
+    Align hAlign = Align::Start;
+    Align vAlign = Align::Start;
+
+    // extent of the text, kept until the text, font or measurer changes
+    std::shared_ptr<const TextLayout> layout;
+    const TextMeasurer* measuredWith = nullptr;
+
+public:
+    Rect rect;
+    Size measured;
+
+    Text(std::wstring t = L"", const TextStyle& st = {}) : text(std::move(t)), style(st) {}
+
+    void setText(std::wstring_view t) {
+        if (text == t) return;
+        text.assign(t);
+        layout.reset();
+    }
+    const std::wstring& getText() const { return text; }
+
+    // font changes need the layout again
+    TextStyle& getStyle() { layout.reset(); return style; }
+    const TextStyle& getStyle() const { return style; }
+
+    void setPadding(int p) { padding = p; }
+    void setAlign(Align h, Align v = Align::Start) { hAlign = h; vAlign = v; }
+
+    Size measure(const LayoutConstraints& c) {
+        const TextMeasurer* src = cachingTextMeasurer().source();
+        if (!layout || measuredWith != src) {
+            layout = textMeasurer().layoutShared(style.getFont(), text, 0, false);
+            measuredWith = src;
+        }
+        return measured = { clampDouble(layout->extent.w + 2 * padding, c.minW, c.maxW),
+                            clampDouble(layout->extent.h + 2 * padding, c.minH, c.maxH) };
+    }
+
+    void arrange(const Rect& bounds) { rect = bounds; }
+
+    void draw(Renderer& r, int ox, int oy) const {
+        Rect box = { (double)(int)(ox + rect.x), (double)(int)(oy + rect.y), (double)(int)rect.w, (double)(int)rect.h };
+        if (!style.transparentBg) r.fillRect(box, style.bgColor);
+        TextFormat fmt;
+        fmt.hAlign = hAlign;
+        fmt.vAlign = vAlign;
+        r.drawText({ box.x + padding, box.y + padding, box.w - 2 * padding, box.h - 2 * padding }, text,
+                   style.getFont(), style.textColor, fmt, layout.get());
+    }
+};
+
+// solid rectangle filling its bounds; no size of its own (see Sized)
+class Fill {
+public:
+    Color color = Color::rgb(0, 0, 0);
+    Rect rect;
+    Size measured;
+
+    Fill() = default;
+    explicit Fill(Color c) : color(c) {}
+
+    Size measure(const LayoutConstraints& c) { return measured = { c.minW, c.minH }; }
+    void arrange(const Rect& bounds) { rect = bounds; }
+    void draw(Renderer& r, int ox, int oy) const {
+        r.fillRect({ (double)(int)(ox + rect.x), (double)(int)(oy + rect.y), (double)(int)rect.w, (double)(int)rect.h }, color);
+    }
+};
+
+// fixed W x H (clamped to the constraints, like Widget::setFixedSize); the child fills it
+template <int W, int H, class Child>
+class Sized {
+public:
+    Child child;
+    Rect rect;
+    Size measured;
+
+    Sized() = default;
+    explicit Sized(Child c) : child(std::move(c)) {}
+
+    Size measure(const LayoutConstraints& c) {
+        child.measure(c);
+        return measured = { clampDouble(W, c.minW, c.maxW), clampDouble(H, c.minH, c.maxH) };
+    }
+    void arrange(const Rect& bounds) {
+        rect = bounds;
+        child.arrange({ 0, 0, bounds.w, bounds.h });
+    }
+    void draw(Renderer& r, int ox, int oy) const { child.draw(r, ox + (int)rect.x, oy + (int)rect.y); }
+};
+
+// children stacked along one axis, StackLayout semantics (cross axis stretched)
+template <Orientation O, int Spacing, int Padding, class... Children>
+class Stack {
+public:
+    std::tuple<Children...> children;
+    Rect rect;
+    Size measured;
+    Color background = Color::rgb(240, 240, 240);
+    bool filled = false;   // draw the background, like a Panel
+
+    Stack() = default;
+    explicit Stack(Children... c) requires(sizeof...(Children) > 0) : children(std::move(c)...) {}
+
+    template <size_t I> auto& get() { return std::get<I>(children); }
+    template <size_t I> const auto& get() const { return std::get<I>(children); }
+
+    void setBackground(Color c) { background = c; filled = true; }
+
+    Size measure(const LayoutConstraints& c) {
+        constexpr bool vertical = O == Orientation::Vertical;
+        LayoutConstraints cc = LayoutConstraints::Unbounded();
+        if constexpr (vertical) cc.minW = c.minW, cc.maxW = c.maxW;
+        else cc.minH = c.minH, cc.maxH = c.maxH;
+        Size s;
+        std::apply([&](auto&... ch) {
+            ([&](Size p) {
+                if constexpr (vertical) s.h += p.h, s.w = std::max(s.w, p.w);
+                else s.w += p.w, s.h = std::max(s.h, p.h);
+            }(ch.measure(cc)), ...);
+        }, children);
+        constexpr double gaps = sizeof...(Children) > 0 ? (double)Spacing * (sizeof...(Children) - 1) : 0.0;
+        (vertical ? s.h : s.w) += gaps;
+        return measured = { clampDouble(s.w + 2 * Padding, c.minW, c.maxW), clampDouble(s.h + 2 * Padding, c.minH, c.maxH) };
+    }
+
+    void arrange(const Rect& bounds) {
+        rect = bounds;
+        double availW = bounds.w - 2 * Padding, availH = bounds.h - 2 * Padding;
+        double offset = 0;
+        std::apply([&](auto&... ch) {
+            ([&](auto& child) {
+                if constexpr (O == Orientation::Vertical) {
+                    child.arrange({ (double)Padding, Padding + offset, availW, child.measured.h });
+                    offset += child.measured.h + Spacing;
+                } else {
+                    child.arrange({ Padding + offset, (double)Padding, child.measured.w, availH });
+                    offset += child.measured.w + Spacing;
+                }
+            }(ch), ...);
+        }, children);
+    }
+
+    void draw(Renderer& r, int ox, int oy) const {
+        int x = ox + (int)rect.x, y = oy + (int)rect.y;
+        if (filled) r.fillRect({ (double)x, (double)y, (double)(int)rect.w, (double)(int)rect.h }, background);
+        std::apply([&](const auto&... ch) { (ch.draw(r, x, y), ...); }, children);
+    }
+};
+
+template <int Spacing, int Padding, class... Children>
+using Column = Stack<Orientation::Vertical, Spacing, Padding, Children...>;
+template <int Spacing, int Padding, class... Children>
+using Row = Stack<Orientation::Horizontal, Spacing, Padding, Children...>;
+
+// node reached by child indices: at<1, 0>(tree) is the first child of the second child
+template <size_t I, size_t... Rest, class Node>
+auto& at(Node& n) {
+    auto& child = [&]() -> auto& {
+        if constexpr (requires { n.child; }) { static_assert(I == 0, "Sized has one child"); return n.child; }
+        else return n.template get<I>();
+    }();
+    if constexpr (sizeof...(Rest) == 0) return child;
+    else return at<Rest...>(child);
+}
+
+} // namespace static_tree
+
+// -------------------------------
+// StaticWidget: a static tree as one node of a dynamic Widget tree. Widget's
+// measure cache and arrange skipping apply to the whole tree at once; call
+// edit() before changing nodes so the next layout and paint pick them up.
+template <class Tree>
+class StaticWidget : public Widget {
+    Tree root;
+
+public:
+    StaticWidget() = default;
+    explicit StaticWidget(Tree t) : root(std::move(t)) {}
+
+    const Tree& content() const { return root; }
+    Tree& edit() {
+        markLayoutDirty();
+        markDirty();
+        return root;
+    }
+
+    Size measureOverride(const LayoutConstraints& c) const override {
+        return meansureSize = const_cast<Tree&>(root).measure(c);
+    }
+
+    void arrangeChildren(const Rect& bounds) override { root.arrange({ 0, 0, bounds.w, bounds.h }); }
+
+    void draw(Renderer& r, int ox = 0, int oy = 0) override {
+        root.draw(r, ox + (int)rect.x, oy + (int)rect.y);
+        Widget::draw(r, ox, oy);
+    }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<StaticWidget>(*this); }
+};
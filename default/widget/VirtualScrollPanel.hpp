@@ -0,0 +1,250 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include <cmath>
+#include "Panel.hpp"
+
+// -------------------------------
+// RowHeightIndex: row offsets for a virtual list. Measured heights live in a
+// Fenwick tree; rows not measured yet count as the running average height.
+class RowHeightIndex {
+    std::vector<double> sum;      // 1-based Fenwick over measured heights
+    std::vector<uint32_t> cnt;    // 1-based Fenwick over "row is measured"
+    std::vector<float> height;    // per row, < 0 = not measured
+    double measuredTotal = 0;
+    size_t measuredCount = 0;
+
+public:
+    double fallbackHeight = 20.0;   // estimate before any row is measured
+
+    size_t size() const { return height.size(); }
+
+    void clear() {
+        sum.assign(1, 0.0);
+        cnt.assign(1, 0);
+        height.clear();
+        measuredTotal = 0;
+        measuredCount = 0;
+    }
+
+    // grows in O(k log n) for k appended rows (log views); shrinking rebuilds
+    void resize(size_t n) {
+        if (n < height.size()) {
+            std::vector<float> keep(height.begin(), height.begin() + n);
+            clear();
+            resize(n);
+            for (size_t i = 0; i < n; ++i) if (keep[i] >= 0) set(i, keep[i]);
+            return;
+        }
+        if (sum.empty()) clear();
+        for (size_t i = height.size() + 1; i <= n; ++i) {
+            // node i covers (i - lowbit(i), i]; the new row itself is unmeasured
+            size_t lo = i - (i & (~i + 1));
+            sum.push_back(prefixSum(i - 1) - prefixSum(lo));
+            cnt.push_back((uint32_t)(prefixCount(i - 1) - prefixCount(lo)));
+            height.push_back(-1.0f);
+        }
+    }
+
+    bool measured(size_t i) const { return height[i] >= 0; }
+
+    void set(size_t i, double h) {
+        double old = height[i];
+        if (old == (float)h) return;
+        double dh = old >= 0 ? h - old : h;
+        if (old < 0) {
+            ++measuredCount;
+            for (size_t k = i + 1; k < cnt.size(); k += k & (~k + 1)) ++cnt[k];
+        }
+        measuredTotal += dh;
+        height[i] = (float)h;
+        for (size_t k = i + 1; k < sum.size(); k += k & (~k + 1)) sum[k] += dh;
+    }
+
+    double estimate() const { return measuredCount ? measuredTotal / measuredCount : fallbackHeight; }
+
+    double rowHeight(size_t i) const { return measured(i) ? height[i] : estimate(); }
+
+    // top of row i (i == size() gives the total height)
+    double offset(size_t i) const {
+        size_t m = prefixCount(i);
+        return prefixSum(i) + (double)(i - m) * estimate();
+    }
+
+    double total() const { return offset(size()); }
+
+    // row containing y, clamped to [0, size())
+    size_t indexAt(double y) const {
+        size_t lo = 0, hi = size();
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (offset(mid) <= y) lo = mid; else hi = mid;
+        }
+        return lo;
+    }
+
+private:
+    double prefixSum(size_t i) const {
+        double s = 0;
+        for (; i > 0; i -= i & (~i + 1)) s += sum[i];
+        return s;
+    }
+    size_t prefixCount(size_t i) const {
+        size_t c = 0;
+        for (; i > 0; i -= i & (~i + 1)) c += cnt[i];
+        return c;
+    }
+};
+
+// -------------------------------
+// VirtualScrollPanel: vertical list over an item-count + item-factory source.
+// Only the rows inside the viewport (plus overscan) exist as arranged widgets;
+// rows scrolled out are hidden and rebound to new indices instead of being
+// destroyed. Unmeasured rows use the average measured height.
+class VirtualScrollPanel : public ScrollPanel {
+public:
+    struct Source {
+        std::function<size_t()> count;
+        std::function<std::unique_ptr<Widget>()> create;     // new empty row widget
+        std::function<void(Widget&, size_t)> bind;           // show item i in a (possibly recycled) row
+    };
+
+    double overscan = 200.0;   // px realized above and below the viewport
+
+private:
+    Source source;
+    RowHeightIndex heights;
+    std::vector<std::pair<size_t, Widget*>> live;   // realized rows, ascending index
+    std::vector<Widget*> pool;                      // hidden rows ready for reuse
+
+public:
+    VirtualScrollPanel() = default;
+    explicit VirtualScrollPanel(Source s) : source(std::move(s)) {}
+
+    void setSource(Source s) {
+        source = std::move(s);
+        reload();
+    }
+
+    // data changed: forget measured heights and rebind every realized row
+    void reload() {
+        heights.clear();
+        for (auto& [i, w] : live) recycle(w);
+        live.clear();
+        markLayoutDirty();
+        markDirty();
+    }
+
+    // rows appended/removed at the end: keep measured heights, realize again
+    void refresh() {
+        markLayoutDirty();
+        markDirty();
+    }
+
+    const RowHeightIndex& rowHeights() const { return heights; }
+    size_t realizedCount() const { return live.size(); }
+    size_t pooledCount() const { return pool.size(); }
+
+    void scroll(double dy) override {
+        scrollY = std::max(0.0, scrollY + dy);
+        realize();
+        if (scrollY > contentHeight - rect.h) {
+            scrollY = std::max(0.0, contentHeight - rect.h);
+            realize();
+        }
+        syncStore();
+        markDirty();
+    }
+
+    // size comes from the constraints, never from the rows
+    Size measureOverride(const LayoutConstraints& c) const override {
+        double w = std::isfinite(c.maxW) ? c.maxW : std::max(c.minW, rect.w);
+        double h = std::isfinite(c.maxH) ? c.maxH : clampDouble(heights.total(), c.minH, c.maxH);
+        return { w, h };
+    }
+
+    // rows can't change our size when both axes are bounded
+    bool isRelayoutBoundary() const override {
+        if (Widget::isRelayoutBoundary()) return true;
+        const LayoutConstraints& c = getLastConstraints();
+        return measuredOnce && std::isfinite(c.maxW) && std::isfinite(c.maxH);
+    }
+
+    void arrangeChildren(const Rect&) override { realize(); }
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<VirtualScrollPanel>(*this); }
+
+    // cloned rows keep their index; the copy's live/pool point at its own rows
+    void onCloned(const Widget& proto) override {
+        for (auto& [i, w] : live) w = correspondingChild(proto, w);
+        for (Widget*& w : pool) w = correspondingChild(proto, w);
+    }
+
+private:
+    Widget* takeRow() {
+        if (!pool.empty()) {
+            Widget* w = pool.back();
+            pool.pop_back();
+            w->setVisible(true);
+            return w;
+        }
+        auto row = source.create ? source.create() : std::make_unique<Widget>();
+        Widget* w = row.get();
+        addChild(std::move(row));
+        return w;
+    }
+
+    void recycle(Widget* w) {
+        w->setVisible(false);
+        pool.push_back(w);
+    }
+
+    void realize() {
+        size_t n = source.count ? source.count() : 0;
+        if (heights.size() != n) heights.resize(n);
+
+        double top = std::max(0.0, scrollY - overscan);
+        double bottom = scrollY + rect.h + overscan;
+        LayoutConstraints rowC{ rect.w, 0, rect.w, std::numeric_limits<double>::infinity() };
+
+        size_t first = n ? heights.indexAt(top) : 0;
+
+        // drop rows that left the window (or the list)
+        std::vector<std::pair<size_t, Widget*>> old;
+        old.swap(live);
+        size_t k = 0;
+        while (k < old.size() && old[k].first < first) recycle(old[k++].second);
+
+        // walk down from first, measuring rows until the window is covered
+        double y = heights.offset(first);
+        for (size_t i = first; i < n && y < bottom; ++i) {
+            Widget* w;
+            if (k < old.size() && old[k].first == i) {
+                w = old[k++].second;
+            } else {
+                w = takeRow();
+                if (source.bind) source.bind(*w, i);
+                w->markLayoutDirty();   // recycled row shows new content
+            }
+            Size s = w->measure(rowC);
+            heights.set(i, s.h);
+            live.push_back({i, w});
+            y += s.h;
+        }
+        for (; k < old.size(); ++k) recycle(old[k].second);
+
+        // place rows; offsets use heights measured above
+        y = heights.offset(first);
+        for (auto& [i, w] : live) {
+            double h = heights.rowHeight(i);
+            w->arrange({0, y, rect.w, h});
+            y += h;
+        }
+        contentHeight = heights.total();
+
+        // binding rows marks us dirty again; this pass already covered it
+        layoutDirty = false;
+        hitIndexDirty = true;
+    }
+};
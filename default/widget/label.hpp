@@ -1,7 +1,7 @@
 #pragma once
 #include <string>
-#include <windows.h>
-#include "../core/widget.hpp"
+#include "../../core/widget.hpp"
+#include "../../core/cow.hpp"
 #include "../style.hpp"
 
 class Label : public Widget {
@@ -10,8 +10,9 @@ public:
     enum class VAlign { Top, Middle, Bottom };
 
 private:
-    TextStyle style;
-    std::wstring text;
+    // shared with clones until one of them changes it
+    Cow<TextStyle> style;
+    Cow<std::wstring> text;
     int padding = 2;
     HAlign hAlign = HAlign::Left;
     VAlign vAlign = VAlign::Top;
@@ -19,109 +20,97 @@ private:
     bool ellipsize = false;
     int maxLines = 0;
 
+    // line breaks from the last measure, reused by draw when the width still fits
+    mutable std::shared_ptr<const TextLayout> textLayout;
+    mutable double textLayoutWidth = 0;
+
 public:
     Label(const std::wstring& t = L"", const TextStyle& st = {})
         : style(st), text(t)
     {}
 
-    void setText(const std::wstring& t) { text = t; markDirty(); }
+    // labels built from one style share it until one of them changes it
+    Label(std::wstring t, const Cow<TextStyle>& st)
+        : style(st), text(std::move(t))
+    {}
+
+    void setText(const std::wstring& t) { text = t; textLayout.reset(); markLayoutDirty(); markDirty(); }
     void setPadding(int p) { padding = p; markLayoutDirty(); markDirty(); }
 
-    TextStyle& getStyle() { return style; }
-    const TextStyle& getStyle() const { return style; }
+    // mutable access assumes the style changes: the text is measured and drawn
+    // again on the next frame (read through the const overload to avoid that)
+    TextStyle& getStyle() { styleChanged(); return style.write(); }
+    const TextStyle& getStyle() const { return *style; }
+    const std::wstring& getText() const { return *text; }
 
     // forward -> operator to style:
-    TextStyle* operator->() { return &style; }
+    TextStyle* operator->() { styleChanged(); return &style.write(); }
+    const TextStyle* operator->() const { return &*style; }
 
     void setHAlign(HAlign a) { hAlign = a; markDirty(); }
     void setVAlign(VAlign a) { vAlign = a; markDirty(); }
-    void setWrap(bool w) { wrap = w; markLayoutDirty(); markDirty(); }
+    void setWrap(bool w) { wrap = w; textLayout.reset(); markLayoutDirty(); markDirty(); }
     void setEllipsize(bool e) { ellipsize = e; markLayoutDirty(); markDirty(); }
     void setMaxLines(int n) { maxLines = n; markLayoutDirty(); markDirty(); }
 
     // --- Draw ---
-    void draw(HDC hdc, int ox = 0, int oy = 0) override {
-        HFONT oldFont = (HFONT)SelectObject(hdc, style.getFont());
-        RECT r = { (int)(ox + rect.x), (int)(oy + rect.y),
-                   (int)(ox + rect.x + rect.w), (int)(oy + rect.y + rect.h) };
-
-        if (!style.transparentBg) {
-            HBRUSH br = CreateSolidBrush(style.bgColor);
-            FillRect(hdc, &r, br);
-            DeleteObject(br);
-        }
+    void draw(Renderer& r, int ox = 0, int oy = 0) override {
+        Rect box = { (double)(int)(ox + rect.x), (double)(int)(oy + rect.y),
+                     (double)(int)rect.w, (double)(int)rect.h };
 
-        SetBkMode(hdc, TRANSPARENT);
-        SetTextColor(hdc, style.textColor);
+        if (!style->transparentBg) r.fillRect(box, style->bgColor);
 
-        RECT ir = { r.left + padding, r.top + padding, r.right - padding, r.bottom - padding };
-        UINT flags = DT_NOPREFIX;
+        Rect ir = { box.x + padding, box.y + padding, box.w - 2 * padding, box.h - 2 * padding };
+        TextFormat fmt;
+        fmt.wrap = wrap;
+        fmt.ellipsize = !wrap && ellipsize;
 
-        if (wrap) {
-            flags |= DT_WORDBREAK;
-        } else {
-            flags |= DT_SINGLELINE;
-            if (ellipsize) flags |= DT_END_ELLIPSIS;
-        }
-
-        if (hAlign == HAlign::Center) flags |= DT_CENTER;
-        else if (hAlign == HAlign::Right) flags |= DT_RIGHT;
+        if (hAlign == HAlign::Center) fmt.hAlign = Align::Center;
+        else if (hAlign == HAlign::Right) fmt.hAlign = Align::End;
 
+        const TextLayout* tl = textLayout.get();
         if (!wrap) {
-            if (vAlign == VAlign::Middle) flags |= DT_VCENTER;
-            else if (vAlign == VAlign::Bottom) flags |= DT_BOTTOM;
+            if (vAlign == VAlign::Middle) fmt.vAlign = Align::Center;
+            else if (vAlign == VAlign::Bottom) fmt.vAlign = Align::End;
         } else {
-            RECT measureRect = ir;
-            DrawTextW(hdc, text.c_str(), (int)text.size(), &measureRect, flags | DT_CALCRECT);
-            int textH = measureRect.bottom - measureRect.top;
-            int availH = ir.bottom - ir.top;
-            int dy = 0;
-            if (vAlign == VAlign::Middle) dy = (availH - textH) / 2;
-            else if (vAlign == VAlign::Bottom) dy = availH - textH;
+            // greedy breaks are the same for any width in [extent.w, measured width]
+            if (!tl || ir.w < tl->extent.w || ir.w > textLayoutWidth) {
+                textLayout = textMeasurer().layoutShared(style->getFont(), *text, ir.w, true);
+                textLayoutWidth = ir.w;
+                tl = textLayout.get();
+            }
+            double textH = tl->extent.h;
+            double dy = 0;
+            if (vAlign == VAlign::Middle) dy = (int)((ir.h - textH) / 2);
+            else if (vAlign == VAlign::Bottom) dy = ir.h - textH;
             if (dy < 0) dy = 0;
-            ir.top += dy;
+            ir.y += dy;
+            ir.h -= dy;
         }
 
-        DrawTextW(hdc, text.c_str(), (int)text.size(), &ir, flags);
-        SelectObject(hdc, oldFont);
+        r.drawText(ir, *text, style->getFont(), style->textColor, fmt, tl);
 
-        Widget::draw(hdc, ox, oy);
+        Widget::draw(r, ox, oy);
     }
 
     // --- Measure ---
-    Size measure(const LayoutConstraints& c) const override {
-        HDC hdc = CreateCompatibleDC(nullptr);
-        HFONT oldFont = (HFONT)SelectObject(hdc, style.getFont());
-
+    Size measureOverride(const LayoutConstraints& c) const override {
         Size s{0, 0};
-        int maxW = (int)clampDouble(c.maxW, 0.0, 1000000.0);
+        double maxW = clampDouble(c.maxW, 0.0, 1000000.0);
 
-        if (!wrap) {
-            SIZE ts{};
-            if (!text.empty())
-                GetTextExtentPoint32W(hdc, text.c_str(), (int)text.size(), &ts);
-            else {
-                TEXTMETRIC tm{};
-                GetTextMetrics(hdc, &tm);
-                ts.cx = 0; ts.cy = tm.tmHeight;
-            }
-            s.w = ts.cx + 2 * padding;
-            s.h = ts.cy + 2 * padding;
-        } else {
-            RECT r = { 0, 0, maxW > 0 ? maxW - 2 * padding : 0, 0 };
-            UINT flags = DT_CALCRECT | DT_WORDBREAK | DT_NOPREFIX;
-            DrawTextW(hdc, text.c_str(), (int)text.size(), &r, flags);
-            s.w = (r.right - r.left) + 2 * padding;
-            s.h = (r.bottom - r.top) + 2 * padding;
-        }
+        textLayoutWidth = wrap && maxW > 0 ? maxW - 2 * padding : 0;
+        textLayout = textMeasurer().layoutShared(style->getFont(), *text, textLayoutWidth, wrap);
+        s.w = textLayout->extent.w + 2 * padding;
+        s.h = textLayout->extent.h + 2 * padding;
 
         s.w = clampDouble(s.w, c.minW, c.maxW);
         s.h = clampDouble(s.h, c.minH, c.maxH);
-
-        SelectObject(hdc, oldFont);
-        DeleteDC(hdc);
-
-        meansureSize = s;
         return s;
     }
-};
+
+protected:
+    std::unique_ptr<Widget> cloneSelf() const override { return std::make_unique<Label>(*this); }
+
+private:
+    void styleChanged() { textLayout.reset(); markLayoutDirty(); markDirty(); }
+};
\ No newline at end of file
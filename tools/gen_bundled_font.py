@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Generates default/render/BundledFont.hpp: quadratic outlines and advances
+# for a subset of DejaVu Sans (ASCII, Latin-1, Vietnamese, a few punctuation
+# marks), read straight from the TrueType file. No dependencies.
+#
+#   python3 tools/gen_bundled_font.py DejaVuSans.ttf > default/render/BundledFont.hpp
+import struct
+import sys
+
+VIETNAMESE = "ăâđêôơưĂÂĐÊÔƠƯĨĩŨũ" + "".join(chr(c) for c in range(0x1EA0, 0x1EFA))
+EXTRA = [0x2013, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2026, 0x20AC, 0xFFFD]
+CODEPOINTS = sorted(set(list(range(0x20, 0x7F)) + list(range(0xA0, 0x100)) + [ord(c) for c in VIETNAMESE] + EXTRA))
+
+LICENSE = """\
+// Glyph outlines: subset of DejaVu Sans (renamed as required by the license).
+// Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved.
+// Bitstream Vera is a trademark of Bitstream, Inc.
+// DejaVu changes are in public domain.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of the fonts accompanying this license ("Fonts") and associated
+// documentation files (the "Font Software"), to reproduce and distribute the
+// Font Software, including without limitation the rights to use, copy, merge,
+// publish, distribute, and/or sell copies of the Font Software, and to permit
+// persons to whom the Font Software is furnished to do so, subject to the
+// following conditions:
+//
+// The above copyright and trademark notices and this permission notice shall
+// be included in all copies of one or more of the Font Software typefaces.
+//
+// The Font Software may be modified, altered, or added to, and in particular
+// the designs of glyphs or characters in the Fonts may be modified and
+// additional glyphs or characters may be added to the Fonts, only if the fonts
+// are renamed to names not containing either the words "Bitstream" or the word
+// "Vera".
+//
+// This License becomes null and void to the extent applicable to Fonts or Font
+// Software that has been modified and is distributed under the "Bitstream
+// Vera" names.
+//
+// The Font Software may be sold as part of a larger software package but no
+// copy of one or more of the Font Software typefaces may be sold by itself.
+//
+// THE FONT SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO ANY WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT OF COPYRIGHT, PATENT,
+// TRADEMARK, OR OTHER RIGHT. IN NO EVENT SHALL BITSTREAM OR THE GNOME
+// FOUNDATION BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, INCLUDING
+// ANY GENERAL, SPECIAL, INDIRECT, INCIDENTAL, OR CONSEQUENTIAL DAMAGES,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+// THE USE OR INABILITY TO USE THE FONT SOFTWARE OR FROM OTHER DEALINGS IN THE
+// FONT SOFTWARE.
+//
+// Except as contained in this notice, the names of Gnome, the Gnome
+// Foundation, and Bitstream Inc., shall not be used in advertising or
+// otherwise to promote the sale, use or other dealings in this Font Software
+// without prior written authorization from the Gnome Foundation or Bitstream
+// Inc., respectively. For further information, contact: fonts at gnome dot
+// org."""
+
+
+class Font:
+    def __init__(self, path):
+        d = self.d = open(path, "rb").read()
+        self.tables = {}
+        for i in range(struct.unpack(">H", d[4:6])[0]):
+            tag, _, off, ln = struct.unpack(">4sIII", d[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode()] = off
+        head, hhea, maxp = self.tables["head"], self.tables["hhea"], self.tables["maxp"]
+        self.upem = self.u16(head + 18)
+        longLoca = self.s16(head + 50) == 1
+        self.ascender, self.descender, self.lineGap = self.s16(hhea + 4), self.s16(hhea + 6), self.s16(hhea + 8)
+        metrics = self.u16(hhea + 34)
+        count = self.u16(maxp + 4)
+        loca = self.tables["loca"]
+        self.loca = [struct.unpack(">I", d[loca + 4 * i:loca + 4 * i + 4])[0] if longLoca else 2 * self.u16(loca + 2 * i)
+                     for i in range(count + 1)]
+        hmtx = self.tables["hmtx"]
+        self.advance = [self.u16(hmtx + 4 * min(i, metrics - 1)) for i in range(count)]
+        self.cmap = self.readCmap()
+
+    def u16(self, o):
+        return struct.unpack(">H", self.d[o:o + 2])[0]
+
+    def s16(self, o):
+        return struct.unpack(">h", self.d[o:o + 2])[0]
+
+    def readCmap(self):
+        base = self.tables["cmap"]
+        out = {}
+        for i in range(self.u16(base + 2)):
+            platform, encoding, off = struct.unpack(">HHI", self.d[base + 4 + 8 * i:base + 12 + 8 * i])
+            if (platform, encoding) != (3, 1):
+                continue
+            o = base + off
+            segs = self.u16(o + 6) // 2
+            ends, starts, deltas, ranges = o + 14, o + 16 + 2 * segs, o + 16 + 4 * segs, o + 16 + 6 * segs
+            for k in range(segs):
+                delta, rangeOff = self.s16(deltas + 2 * k), self.u16(ranges + 2 * k)
+                for c in range(self.u16(starts + 2 * k), self.u16(ends + 2 * k) + 1):
+                    if rangeOff == 0:
+                        g = (c + delta) & 0xFFFF
+                    else:
+                        g = self.u16(ranges + 2 * k + rangeOff + 2 * (c - self.u16(starts + 2 * k)))
+                        g = (g + delta) & 0xFFFF if g else 0
+                    out[c] = g
+        return out
+
+    def glyf(self, g):
+        return self.tables["glyf"] + self.loca[g], self.loca[g + 1] - self.loca[g]
+
+    # [(outline glyph, dx, dy)]: composites flattened to simple glyphs
+    def parts(self, g, dx=0, dy=0):
+        o, ln = self.glyf(g)
+        if ln == 0:
+            return []
+        if self.s16(o) >= 0:
+            return [(g, dx, dy)]
+        out, p = [], o + 10
+        while True:
+            flags, child = self.u16(p), self.u16(p + 2)
+            p += 4
+            if flags & 1:
+                ox, oy = struct.unpack(">hh", self.d[p:p + 4])
+                p += 4
+            else:
+                ox, oy = struct.unpack(">bb", self.d[p:p + 2])
+                p += 2
+            assert flags & 2, "point-matched components are not supported"
+            assert not flags & (0x08 | 0x40 | 0x80), "scaled components are not supported"
+            out += self.parts(child, dx + ox, dy + oy)
+            if not flags & 0x20:
+                return out
+
+    # contours of a simple glyph: [[(x, y, onCurve)]]
+    def contours(self, g):
+        o, _ = self.glyf(g)
+        d, n = self.d, self.s16(o)
+        ends = [self.u16(o + 10 + 2 * i) for i in range(n)]
+        p = o + 10 + 2 * n
+        p += 2 + self.u16(p)
+        count = ends[-1] + 1 if n else 0
+        flags = []
+        while len(flags) < count:
+            f = d[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                flags += [f] * d[p]
+                p += 1
+
+        def coords(short, same):
+            nonlocal p
+            out, v = [], 0
+            for f in flags:
+                if f & short:
+                    v += d[p] if f & same else -d[p]
+                    p += 1
+                elif not f & same:
+                    v += self.s16(p)
+                    p += 2
+                out.append(v)
+            return out
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+        out, begin = [], 0
+        for e in ends:
+            out.append([(xs[i], ys[i], flags[i] & 1) for i in range(begin, e + 1)])
+            begin = e + 1
+        return out
+
+
+def table(ctype, name, values, per=16):
+    rows = [", ".join(str(v) for v in values[i:i + per]) for i in range(0, len(values), per)]
+    return "inline constexpr %s %s[] = {\n    %s,\n};\n" % (ctype, name, ",\n    ".join(rows) or "0")
+
+
+def main(path):
+    font = Font(path)
+    outlineIndex, contourEnds, points, outlines = {}, [], [], []
+    glyphs, parts = [], []
+    for cp in CODEPOINTS:
+        g = font.cmap.get(cp)
+        if g is None:
+            continue
+        first = len(parts)
+        for outline, dx, dy in font.parts(g):
+            if outline not in outlineIndex:
+                outlineIndex[outline] = len(outlines)
+                cs = font.contours(outline)
+                outlines.append((len(contourEnds), len(cs)))
+                for c in cs:
+                    for x, y, on in c:
+                        points += [x * 2 + on, y]
+                    contourEnds.append(len(points) // 2)
+            parts += [outlineIndex[outline], dx, dy]
+        glyphs += [cp, font.advance[g], first // 3, (len(parts) - first) // 3]
+
+    out = sys.stdout
+    out.write("#pragma once\n#include <cstdint>\n\n")
+    out.write("// Generated by tools/gen_bundled_font.py - do not edit.\n//\n")
+    out.write(LICENSE + "\n\n")
+    out.write("// Units are font units (unitsPerEm per em), y up from the baseline.\n")
+    out.write("namespace bundled_font {\n\n")
+    out.write("constexpr int unitsPerEm = %d;\nconstexpr int ascender = %d;\nconstexpr int descender = %d;\nconstexpr int lineGap = %d;\n\n"
+              % (font.upem, font.ascender, font.descender, font.lineGap))
+    out.write("// per glyph: codepoint, advance, first part, part count; sorted by codepoint\n")
+    out.write(table("uint32_t", "glyphs", glyphs, 12) + "\n")
+    out.write("// per part: outline, dx, dy (accented letters reuse the base and mark outlines)\n")
+    out.write(table("int16_t", "parts", parts, 18) + "\n")
+    out.write("// per outline: first contour, contour count\n")
+    out.write(table("uint16_t", "outlines", [v for o in outlines for v in o], 16) + "\n")
+    out.write("// per contour: end (exclusive) in points\n")
+    out.write(table("uint16_t", "contourEnds", contourEnds, 16) + "\n")
+    out.write("// per point: x * 2 + onCurve, y\n")
+    out.write(table("int16_t", "points", points, 16) + "\n")
+    out.write("} // namespace bundled_font\n")
+
+
+if __name__ == "__main__":
+    main(sys.argv[1] if len(sys.argv) > 1 else "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf")
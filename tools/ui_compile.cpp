@@ -0,0 +1,31 @@
+// Compiles a textual UI description into the binary format UiFile loads.
+//
+//   ui_compile INPUT.ui OUTPUT.wui [--wchar 2|4]
+//
+// --wchar: wchar_t size of the platform that loads the file (default: this one)
+#include "../widget.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+int main(int argc, char** argv) {
+    const char* in = nullptr;
+    const char* out = nullptr;
+    uint16_t wcharSize = sizeof(wchar_t);
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--wchar") && i + 1 < argc) wcharSize = (uint16_t)std::atoi(argv[++i]);
+        else if (!in) in = argv[i];
+        else if (!out) out = argv[i];
+        else in = nullptr, i = argc;
+    }
+    if (!in || !out || (wcharSize != 2 && wcharSize != 4)) {
+        std::fprintf(stderr, "usage: %s INPUT.ui OUTPUT.wui [--wchar 2|4]\n", argv[0]);
+        return 2;
+    }
+    std::string error;
+    if (!UiCompiler::compileFile(in, out, &error, wcharSize)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -1,10 +1,20 @@
-#pragma one
+#pragma once
 #ifndef WIDGET_LIB_HPP
 #define WIDGET_LIB_HPP
 #include "core/widget.hpp"
 #include "core/layout.hpp"
+#include "core/text.hpp"
+#include "core/renderer.hpp"
+#include "core/resourceCache.hpp"
+#include "core/treeStore.hpp"
+#include "core/arena.hpp"
+#include "core/cow.hpp"
+#include "core/taskPool.hpp"
+#include "core/parallelLayout.hpp"
+#include "core/profiler.hpp"
 
 #include "core/widgetManager.hpp"
+#include "core/frameScheduler.hpp"
 #include "core/widgetBuilder.hpp"
 
 
@@ -13,6 +23,18 @@
 
 #include "default/style.hpp"
 #include "default/widget/label.hpp"
+#include "default/widget/Panel.hpp"
+#include "default/widget/VirtualScrollPanel.hpp"
+#include "default/widget/StaticTree.hpp"
+
+#include "default/ui/UiCompiler.hpp"
+#include "default/ui/UiLoader.hpp"
+
+#include "default/render/PixelKernels.hpp"
+#include "default/render/GlyphCache.hpp"
+#include "default/render/SoftwareRenderer.hpp"
+#include "default/render/TiledSoftwareRenderer.hpp"
+#include "default/render/GdiRenderer.hpp"
 
 
 #endif
\ No newline at end of file